@@ -0,0 +1,236 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_ADDRESS_INDEX_H
+#define INTCOIN_MOBILE_ADDRESS_INDEX_H
+
+#include <intcoin/mobile_memory.h>
+#include <intcoin/script.h>
+#include <intcoin/transaction.h>
+#include <intcoin/types.h>
+#include <intcoin/wallet.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// SHA3-256 of an output script; the key wallet scripts are indexed by
+using ScriptHash = uint256;
+
+/// Hash of an output script
+ScriptHash ScriptHashOf(const Script& script);
+
+/// Hash of the output script paying to an address
+/// @param address INTcoin Bech32 address
+/// @return Script hash, or error if the address is invalid
+Result<ScriptHash> ScriptHashForAddress(const std::string& address);
+
+/// Unspent output held by the index
+struct IndexedUTXO {
+    uint256 tx_hash;
+    uint32_t output_index = 0;
+    uint64_t amount = 0;
+    uint64_t block_height = 0;  // 0 = unconfirmed
+};
+
+/// Transaction touching a script
+struct IndexedHistoryEntry {
+    uint256 tx_hash;
+    int64_t delta_ints = 0;     // Received minus spent by this script
+    uint64_t block_height = 0;  // 0 = unconfirmed
+};
+
+/// Running totals for a script, an account or the whole wallet
+struct IndexedBalance {
+    uint64_t confirmed = 0;
+    uint64_t unconfirmed = 0;
+    uint32_t utxo_count = 0;
+};
+
+/// Script hash to UTXO and history index over the wallet's scripts
+/// Built from the wallet (FromWallet) and maintained from block and
+/// mempool transactions. Totals are kept per
+/// script, per account and for the wallet, and each level keeps its own
+/// list of coins, so a query costs time proportional to its result
+/// rather than to the size of the wallet. Coins, history and watched
+/// scripts are allocated through the index's own memory accounts.
+class AddressIndex {
+public:
+    /// @param max_reorg_depth Blocks of undo data kept for disconnects
+    explicit AddressIndex(size_t max_reorg_depth = 100);
+
+    /// Index a wallet's addresses, coins and transaction history
+    /// The wallet reports history per wallet rather than per address, so a
+    /// transaction is attributed to a script through the coins it left
+    /// there; one whose outputs are all spent stays in the wallet history
+    /// only. Unconfirmed transactions are applied on top.
+    /// @param wallet Wallet to read
+    /// @param unconfirmed Sent transactions the wallet may not reflect yet
+    /// @return New index
+    static std::shared_ptr<AddressIndex> FromWallet(wallet::Wallet& wallet,
+                                                    const std::vector<Transaction>& unconfirmed = {});
+
+    /// Start indexing an address
+    /// @param address Wallet address
+    /// @param account Account the address belongs to
+    /// @return Script hash of the address
+    Result<ScriptHash> Watch(const std::string& address, uint32_t account = 0);
+
+    /// Check whether a script is indexed
+    bool IsWatched(const ScriptHash& script_hash) const;
+
+    /// Add a coin known from elsewhere (e.g. the wallet at open)
+    /// Also records its transaction in the script's history.
+    /// @param script_hash Watched script the coin pays to
+    /// @param utxo Coin
+    void AddUTXO(const ScriptHash& script_hash, const IndexedUTXO& utxo);
+
+    /// Apply an unconfirmed transaction
+    /// Outputs to watched scripts become coins and spent coins are removed.
+    void AddTransaction(const Transaction& tx);
+
+    /// Apply the wallet transactions of a block connected at the tip
+    /// Transactions already applied unconfirmed are marked confirmed.
+    /// @param height Block height
+    /// @param txs Transactions in the block that matched the wallet filter
+    void BlockConnected(uint64_t height, const std::vector<Transaction>& txs);
+
+    /// Undo every block at or above a height
+    /// @param height Height of the removed block
+    void BlockDisconnected(uint64_t height);
+
+    /// Drop everything (watched scripts included)
+    void Clear();
+
+    // ========================================
+    // Queries
+    // ========================================
+
+    IndexedBalance GetBalance(const ScriptHash& script_hash) const;
+    IndexedBalance GetAccountBalance(uint32_t account) const;
+    IndexedBalance GetWalletBalance() const;
+
+    std::vector<IndexedUTXO> GetUTXOs(const ScriptHash& script_hash) const;
+    std::vector<IndexedUTXO> GetAccountUTXOs(uint32_t account) const;
+    std::vector<IndexedUTXO> GetWalletUTXOs() const;
+
+    /// Page of a script's history, newest first
+    /// @param script_hash Script
+    /// @param offset Entries to skip
+    /// @param limit Maximum entries to return
+    /// @param total_count Set to the script's history size (optional)
+    /// @return History entries
+    std::vector<IndexedHistoryEntry> GetHistory(const ScriptHash& script_hash, size_t offset,
+                                                size_t limit, size_t* total_count = nullptr) const;
+
+    /// Add the index's UTXO, history and address book memory to a report
+    void AddMemoryUsage(MemoryUsage* usage) const;
+
+private:
+    struct Uint256Hasher {
+        size_t operator()(const uint256& hash) const;
+    };
+
+    struct CoinKey {
+        uint256 tx_hash;
+        uint32_t output_index;
+
+        bool operator==(const CoinKey& other) const {
+            return output_index == other.output_index && tx_hash == other.tx_hash;
+        }
+    };
+
+    struct CoinKeyHasher {
+        size_t operator()(const CoinKey& key) const;
+    };
+
+    /// Coin slot; also records its position in each list it is on
+    struct Coin {
+        IndexedUTXO utxo;
+        uint32_t script = 0;  // Index into scripts_
+        size_t script_pos = 0;
+        size_t account_pos = 0;
+        size_t wallet_pos = 0;
+    };
+
+    /// Coins and totals of one level (script, account or wallet)
+    struct CoinList {
+        TrackedVector<uint32_t> coins;  // Indices into coins_
+        IndexedBalance balance;
+
+        explicit CoinList(MemoryAccount* account) : coins(TrackedAllocator<uint32_t>(account)) {}
+    };
+
+    struct ScriptEntry {
+        uint32_t account = 0;
+        CoinList coins;
+        TrackedVector<IndexedHistoryEntry> history;
+        TrackedUnorderedMap<uint256, size_t, Uint256Hasher> history_pos;
+
+        ScriptEntry(uint32_t account_id, MemoryTracker& memory);
+    };
+
+    /// Changes made by one block, reverted when it disconnects
+    struct BlockUndo {
+        TrackedVector<CoinKey> created;
+        TrackedVector<CoinKey> confirmed;
+        TrackedVector<Coin> spent;
+        TrackedVector<std::pair<uint32_t, uint256>> history_created;
+        TrackedVector<std::pair<uint32_t, uint256>> history_confirmed;
+
+        explicit BlockUndo(MemoryAccount* account);
+    };
+
+    size_t max_reorg_depth_;
+
+    // Declared before the containers charged to it, so it outlives them
+    MemoryTracker memory_;
+
+    mutable std::mutex mutex_;
+    TrackedVector<ScriptEntry> scripts_;
+    TrackedUnorderedMap<ScriptHash, uint32_t, Uint256Hasher> script_by_hash_;
+    TrackedVector<Coin> coins_;
+    TrackedVector<uint32_t> free_coins_;
+    TrackedUnorderedMap<CoinKey, uint32_t, CoinKeyHasher> coin_by_key_;
+    TrackedUnorderedMap<uint32_t, CoinList> accounts_;
+    CoinList wallet_;
+    TrackedUnorderedMap<uint256, TrackedVector<uint32_t>, Uint256Hasher> tx_scripts_;  // Scripts with history for a tx
+    TrackedMap<uint64_t, BlockUndo> undo_;
+
+    /// Scripts with history for a transaction, created if absent
+    TrackedVector<uint32_t>& TxScripts(const uint256& tx_hash);
+
+    /// Apply one transaction (undo is null for unconfirmed transactions)
+    void ApplyTransaction(const Transaction& tx, uint64_t height, BlockUndo* undo);
+
+    /// Insert a coin; returns false if it is already indexed
+    bool InsertCoin(uint32_t script, const IndexedUTXO& utxo);
+
+    /// Remove a coin and return it
+    Coin RemoveCoin(uint32_t slot);
+
+    /// Move a coin between the confirmed and unconfirmed totals
+    void SetCoinHeight(uint32_t slot, uint64_t block_height);
+
+    /// Add (or with sign -1 remove) a coin in a list's totals
+    static void Credit(CoinList& list, const IndexedUTXO& utxo, int sign);
+
+    /// Remove a script's history entry for a transaction
+    void EraseHistory(uint32_t script, const uint256& tx_hash);
+
+    /// Set the block height of a script's history entry, if it has one
+    void SetHistoryHeight(uint32_t script, const uint256& tx_hash, uint64_t block_height);
+
+    std::vector<IndexedUTXO> CollectUTXOs(const CoinList& list) const;
+};
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_ADDRESS_INDEX_H
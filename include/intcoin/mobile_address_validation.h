@@ -0,0 +1,83 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_ADDRESS_VALIDATION_H
+#define INTCOIN_MOBILE_ADDRESS_VALIDATION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace intcoin {
+namespace mobile {
+
+/// Networks an address may belong to
+enum class AddressNetwork {
+    ANY,
+    MAINNET,  // "int1..."
+    TESTNET,  // "tint1..."
+};
+
+/// Why an address failed validation
+enum class AddressError : uint8_t {
+    OK = 0,
+    TOO_SHORT,          // Under 32 data characters plus checksum
+    TOO_LONG,           // Over the 90-character Bech32 limit
+    UNKNOWN_PREFIX,     // Not "int1" or "tint1" (lower case)
+    WRONG_NETWORK,      // Valid prefix for the other network
+    INVALID_CHARACTER,  // Outside the Bech32 character set
+    MIXED_CASE,         // Upper and lower case letters together
+    INVALID_CHECKSUM,
+    INVALID_PROGRAM,    // Data part does not regroup into a 20-byte hash
+};
+
+/// Bytes in an address payload: the public key hash its scripts pay to
+constexpr size_t ADDRESS_PROGRAM_SIZE = 20;
+
+/// Address payload as bytes
+/// The data part of an address carries it in five-bit groups. This byte
+/// form is the only one the SDK hands around: output scripts, bloom
+/// filter entries and address index keys are all built from it.
+using AddressProgram = std::array<uint8_t, ADDRESS_PROGRAM_SIZE>;
+
+/// Short description of an address error
+const char* AddressErrorString(AddressError error);
+
+/// Validate one address without allocating
+/// Checks prefix, length, character set, case and checksum. The prefix
+/// must be lower case, so upper case addresses are rejected, and the data
+/// part must have at least 32 characters before the checksum.
+/// @param address Address text
+/// @param network Network the address must belong to
+/// @return OK or the first problem found
+AddressError ValidateAddressFast(std::string_view address,
+                                 AddressNetwork network = AddressNetwork::ANY);
+
+/// Validate an address and decode its payload
+/// The five-bit groups are regrouped into bytes; what is left over must be
+/// fewer than five bits, all zero, and the result ADDRESS_PROGRAM_SIZE bytes.
+/// @param address Address text
+/// @param program_out Payload (written only on success)
+/// @param network Network the address must belong to
+/// @return OK or the first problem found
+AddressError DecodeAddressProgram(std::string_view address, AddressProgram* program_out,
+                                  AddressNetwork network = AddressNetwork::ANY);
+
+/// Validate many addresses
+/// Addresses of equal length have their checksums evaluated together,
+/// several per pass, so the polymod loop runs across lanes instead of
+/// one address at a time.
+/// @param addresses Address texts
+/// @param count Number of addresses
+/// @param errors_out Per-address result (count entries)
+/// @param network Network the addresses must belong to
+/// @return Number of valid addresses
+size_t ValidateAddresses(const std::string_view* addresses, size_t count,
+                         AddressError* errors_out,
+                         AddressNetwork network = AddressNetwork::ANY);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_ADDRESS_VALIDATION_H
@@ -0,0 +1,85 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_AMOUNT_H
+#define INTCOIN_MOBILE_AMOUNT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace intcoin {
+namespace mobile {
+
+/// 1 INT = 1,000,000 INTS
+constexpr uint64_t INTS_PER_INT = 1000000;
+constexpr size_t INT_DECIMALS = 6;
+
+/// Longest formatted amount: sign, 14 integer digits, point, six
+/// decimals and the " INT" suffix
+constexpr size_t MAX_AMOUNT_CHARS = 26;
+
+/// How amounts are written
+struct AmountFormat {
+    /// Drop trailing fractional zeros ("1.5", "2") instead of always
+    /// writing six decimals ("1.500000", "2.000000")
+    bool trim_zeros = false;
+
+    /// Append " INT"
+    bool unit_suffix = false;
+};
+
+/// Result of AmountToChars (as std::to_chars_result)
+struct AmountToCharsResult {
+    char* ptr;
+    std::errc ec;  // value_too_large if the range is too small; nothing is written then
+};
+
+/// Result of AmountFromChars (as std::from_chars_result)
+struct AmountFromCharsResult {
+    const char* ptr;
+    std::errc ec;  // invalid_argument if no digits, result_out_of_range on overflow
+};
+
+/// Write an amount in INT without allocating
+/// @param first Start of the output range
+/// @param last End of the output range
+/// @param ints Amount in INTS
+/// @param format Output format
+/// @return One past the last character written (not NUL-terminated)
+AmountToCharsResult AmountToChars(char* first, char* last, uint64_t ints,
+                                  const AmountFormat& format = AmountFormat{});
+
+/// Write a signed amount (e.g. a history entry) in INT
+AmountToCharsResult SignedAmountToChars(char* first, char* last, int64_t ints,
+                                        const AmountFormat& format = AmountFormat{});
+
+/// Parse a decimal amount in INT ("1.5", "2", ".25") to INTS
+/// Like std::from_chars, parsing stops at the first character that does
+/// not fit the pattern, including a seventh decimal; callers that want the
+/// whole input check ptr.
+/// @param first Start of the input
+/// @param last End of the input
+/// @param ints Set to the amount on success
+/// @return One past the last character parsed
+AmountFromCharsResult AmountFromChars(const char* first, const char* last, uint64_t& ints);
+
+/// Format a batch of amounts into fixed-size slots
+/// Amount i is written NUL-terminated at out + i * slot_size.
+/// @param amounts Amounts in INTS
+/// @param count Number of amounts
+/// @param out Output buffer of count * slot_size bytes
+/// @param slot_size Bytes per amount (at least MAX_AMOUNT_CHARS + 1)
+/// @param format Output format
+/// @return Number of amounts written (0 if slot_size is too small)
+size_t FormatAmounts(const uint64_t* amounts, size_t count, char* out, size_t slot_size,
+                     const AmountFormat& format = AmountFormat{});
+
+/// Format a batch of signed amounts into fixed-size slots
+size_t FormatSignedAmounts(const int64_t* amounts, size_t count, char* out, size_t slot_size,
+                           const AmountFormat& format = AmountFormat{});
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_AMOUNT_H
@@ -0,0 +1,273 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_BROADCAST_QUEUE_H
+#define INTCOIN_MOBILE_BROADCAST_QUEUE_H
+
+#include <intcoin/mobile_memory.h>
+#include <intcoin/mobile_raw_tx.h>
+#include <intcoin/spv.h>
+#include <intcoin/types.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+// ========================================
+// Transports
+// ========================================
+
+/// Relays raw transactions to peers
+class BroadcastTransport {
+public:
+    virtual ~BroadcastTransport() = default;
+
+    /// Number of peers that can be relayed to
+    virtual size_t GetPeerCount() const = 0;
+
+    /// Relay to one peer and wait for its acknowledgement
+    /// Called concurrently for different peers.
+    /// @param peer_index Peer in [0, GetPeerCount())
+    /// @param raw_tx Serialized transaction
+    /// @return Ok once the peer has accepted the transaction
+    virtual Result<void> Relay(size_t peer_index, const std::vector<uint8_t>& raw_tx) = 0;
+};
+
+/// Relays through the SPV client
+/// The client already announces to all of its peers and exposes no way to
+/// pick one, so this is a single lane: fanout beyond one peer only happens
+/// over transports with several lanes, such as LoopbackTransport.
+class SPVBroadcastTransport : public BroadcastTransport {
+public:
+    /// Returns the SPV client, opening it if needed (may return null)
+    using ClientProvider = std::function<std::shared_ptr<SPVClient>()>;
+
+    /// @param provider Called on the relay thread, so a queued send opens the
+    ///                 client there rather than on the thread that queued it
+    explicit SPVBroadcastTransport(ClientProvider provider);
+
+    size_t GetPeerCount() const override;
+    Result<void> Relay(size_t peer_index, const std::vector<uint8_t>& raw_tx) override;
+
+private:
+    ClientProvider provider_;
+    std::mutex mutex_;
+};
+
+/// In-process stand-in peers for exercising the queue without a network
+class LoopbackTransport : public BroadcastTransport {
+public:
+    struct Peer {
+        std::chrono::milliseconds latency{50};  // Delay before the ack
+        double failure_rate = 0.0;              // Chance a relay is refused
+    };
+
+    /// @param peers Simulated peers
+    /// @param seed Seed for failure draws
+    explicit LoopbackTransport(std::vector<Peer> peers, uint64_t seed = 1);
+
+    size_t GetPeerCount() const override { return peers_.size(); }
+    Result<void> Relay(size_t peer_index, const std::vector<uint8_t>& raw_tx) override;
+
+    /// Take a peer offline or bring it back
+    void SetPeerOnline(size_t peer_index, bool online);
+
+    /// Relays accepted so far, across all peers
+    uint64_t GetAcceptedCount() const;
+
+private:
+    std::vector<Peer> peers_;
+    std::vector<bool> online_;
+    mutable std::mutex mutex_;
+    std::mt19937_64 rng_;
+    uint64_t accepted_ = 0;
+};
+
+// ========================================
+// Broadcast Queue
+// ========================================
+
+/// Broadcast queue configuration
+struct BroadcastQueueConfig {
+    /// Journal file (empty = keep the queue in memory only)
+    std::string journal_path;
+
+    /// Peers relayed to in parallel per attempt, and the number of relay
+    /// lane threads (a lane stuck in a relay is skipped by later attempts)
+    size_t fanout = 3;
+
+    /// Time to wait for any acknowledgement before an attempt counts as failed
+    std::chrono::milliseconds attempt_timeout{30000};
+
+    /// Backoff after the first failed attempt (doubles per attempt)
+    std::chrono::milliseconds initial_backoff{2000};
+
+    /// Backoff ceiling
+    std::chrono::milliseconds max_backoff{300000};
+
+    /// Give up on a transaction this long after it was queued
+    std::chrono::seconds expiry{72 * 3600};
+};
+
+/// Broadcast queue metrics
+struct BroadcastMetrics {
+    size_t pending = 0;
+    uint64_t enqueued = 0;
+    uint64_t acknowledged = 0;
+    uint64_t expired = 0;
+    uint64_t attempts = 0;
+    uint64_t failed_attempts = 0;
+
+    /// Queued until the first relay went out
+    double avg_first_relay_ms = 0.0;
+    double max_first_relay_ms = 0.0;
+
+    /// Queued until the first peer acknowledged
+    double avg_ack_ms = 0.0;
+    double max_ack_ms = 0.0;
+};
+
+/// Durable outbound transaction queue
+/// Transactions are journaled before Enqueue returns and relayed from a
+/// worker thread. Each attempt fans out to several peers over a fixed set
+/// of lane threads and succeeds on the first acknowledgement; failed
+/// attempts are retried with jittered exponential backoff. Unacknowledged
+/// transactions are picked up again from the journal after a restart.
+/// With a journal configured, Enqueue fails rather than queue a
+/// transaction it could not journal.
+class BroadcastQueue {
+public:
+    /// Transaction left the queue
+    /// @param tx_hash Transaction hash
+    /// @param acknowledged True if a peer accepted it, false if it expired
+    using CompletionCallback = std::function<void(const uint256& tx_hash, bool acknowledged)>;
+
+    /// @param memory Account charged for queued transactions (nullptr = untracked)
+    BroadcastQueue(const BroadcastQueueConfig& config,
+                   std::shared_ptr<BroadcastTransport> transport,
+                   MemoryAccount* memory = nullptr);
+    ~BroadcastQueue();
+
+    BroadcastQueue(const BroadcastQueue&) = delete;
+    BroadcastQueue& operator=(const BroadcastQueue&) = delete;
+
+    /// Load journal and start relaying
+    Result<void> Start();
+
+    /// Stop relaying (queued transactions stay in the journal)
+    /// Waits for relays in flight to return from the transport.
+    void Stop();
+
+    /// Queue a transaction for broadcast
+    /// @param raw_tx Serialized transaction
+    /// @return Transaction hash once the transaction is journaled
+    Result<uint256> Enqueue(std::vector<uint8_t> raw_tx);
+
+    /// Queue a transaction the caller has already parsed
+    /// The view's txid is used as is, so the bytes are not parsed or
+    /// hashed again.
+    /// @param raw_tx Serialized transaction
+    /// @param view View parsed over raw_tx's buffer
+    /// @return Transaction hash once the transaction is journaled
+    Result<uint256> Enqueue(std::vector<uint8_t> raw_tx, const RawTransactionView& view);
+
+    /// Retry every queued transaction now (e.g. when connectivity returns)
+    void RetryNow();
+
+    /// Set completion callback (called on the worker thread)
+    void SetCompletionCallback(CompletionCallback callback);
+
+    /// Check whether a transaction is still queued
+    bool IsPending(const uint256& tx_hash) const;
+
+    /// Number of queued transactions
+    size_t GetPendingCount() const;
+
+    /// Get queue metrics
+    BroadcastMetrics GetMetrics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        uint256 tx_hash;
+        std::shared_ptr<const std::vector<uint8_t>> raw_tx;
+        int64_t queued_unix_ms;       // Wall clock, survives restarts
+        Clock::time_point queued_at;  // For metrics
+        Clock::time_point next_attempt;
+        uint32_t attempts = 0;
+    };
+
+    struct Attempt;
+
+    /// Relay handed to a lane (attempt is null while the lane is idle)
+    struct LaneJob {
+        std::shared_ptr<Attempt> attempt;
+        std::shared_ptr<const std::vector<uint8_t>> raw_tx;
+        size_t peer = 0;
+    };
+
+    BroadcastQueueConfig config_;
+    std::shared_ptr<BroadcastTransport> transport_;
+    MemoryAccount* memory_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_cv_;
+    TrackedDeque<Entry> entries_;
+    std::shared_ptr<Attempt> current_attempt_;
+    std::thread worker_;
+    std::vector<std::thread> lanes_;
+    std::vector<LaneJob> lane_jobs_;  // One per lane, guarded by mutex_
+    std::condition_variable lane_cv_;
+    bool running_ = false;
+    std::mt19937_64 rng_;
+    int journal_fd_ = -1;
+    size_t journal_records_ = 0;
+    CompletionCallback completion_callback_;
+
+    BroadcastMetrics metrics_;
+    uint64_t first_relays_ = 0;
+    double total_first_relay_ms_ = 0.0;
+    double total_ack_ms_ = 0.0;
+
+    void WorkerLoop();
+
+    /// Run the relays handed to one lane until the queue stops
+    void LaneLoop(size_t lane);
+
+    /// Fan out one attempt and wait for the first acknowledgement
+    bool RelayToPeers(const Entry& entry, std::unique_lock<std::mutex>& lock);
+
+    /// Jittered delay before the next attempt
+    std::chrono::milliseconds NextBackoff(uint32_t attempts);
+
+    /// Drop an entry and journal its completion
+    void Complete(const uint256& tx_hash, bool acknowledged, std::unique_lock<std::mutex>& lock);
+
+    Result<void> LoadJournal();
+
+    /// Rewrite the journal with only the queued entries
+    /// The live journal stays open for appends unless the rewrite is in place.
+    Result<void> CompactJournal();
+
+    /// Open the journal for appends if it is not (false if it cannot be)
+    bool EnsureJournalOpen();
+
+    bool AppendJournal(int fd, uint8_t type, const Entry& entry);
+};
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_BROADCAST_QUEUE_H
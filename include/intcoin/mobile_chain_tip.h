@@ -0,0 +1,71 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_CHAIN_TIP_H
+#define INTCOIN_MOBILE_CHAIN_TIP_H
+
+#include <intcoin/spv.h>
+#include <intcoin/types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace intcoin {
+namespace mobile {
+
+/// Immutable view of the chain tip
+struct ChainTip {
+    uint64_t height = 0;
+    uint256 hash{};
+    uint256 chain_work{};  // Zero if the sync layer did not report it
+};
+
+/// Latest chain tip, replaced as a whole when the tip moves
+/// Readers take one snapshot per request without locking, so every
+/// field of a response refers to the same block. Each SDK owns one and
+/// publishes to it from its sync path.
+class ChainTipPublisher {
+public:
+    /// Current tip (null until the first publish)
+    std::shared_ptr<const ChainTip> Get() const {
+        return std::atomic_load(&tip_);
+    }
+
+    /// Replace the tip
+    void Publish(const ChainTip& tip) {
+        std::atomic_store(&tip_, std::make_shared<const ChainTip>(tip));
+    }
+
+private:
+    std::shared_ptr<const ChainTip> tip_;
+};
+
+/// Read the tip from the SPV client
+/// Height and hash are separate calls, so the hash is read on both sides
+/// of the height and the read repeated if a block connected in between.
+/// @param spv_client SPV client (may be null)
+/// @return Chain tip (chain work not known)
+ChainTip ReadChainTip(const std::shared_ptr<SPVClient>& spv_client);
+
+/// Take the tip once for a request
+/// Uses the published snapshot, or reads the client if nothing has been
+/// published yet.
+/// @param publisher Published tip (may be null)
+/// @param spv_client SPV client (may be null)
+/// @return Chain tip
+ChainTip CaptureChainTip(const ChainTipPublisher* publisher,
+                         const std::shared_ptr<SPVClient>& spv_client);
+
+/// Confirmations of a block at the given chain tip (0 if unconfirmed)
+inline uint32_t ConfirmationsAt(uint64_t tip_height, uint64_t block_height) {
+    if (block_height == 0 || block_height > tip_height) {
+        return 0;
+    }
+    return static_cast<uint32_t>(tip_height - block_height + 1);
+}
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_CHAIN_TIP_H
@@ -0,0 +1,100 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_COIN_SELECTION_H
+#define INTCOIN_MOBILE_COIN_SELECTION_H
+
+#include <intcoin/mobile_tx_builder.h>
+#include <intcoin/types.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// Coin selection strategies
+enum class CoinSelectionStrategy {
+    AUTO,              // Branch-and-bound, then knapsack
+    BRANCH_AND_BOUND,  // Exact match without change only
+    KNAPSACK,          // Randomised subset approximation with change
+    LARGEST_FIRST      // Largest coins until the target is met
+};
+
+/// Coin selection parameters
+struct CoinSelectionParams {
+    /// Sum of recipient amounts in INTS
+    uint64_t target = 0;
+
+    /// Fee rate in INTS per KB
+    uint64_t fee_rate = 0;
+
+    /// Number of recipient outputs (change excluded)
+    size_t num_outputs = 1;
+
+    /// Strategy to use
+    CoinSelectionStrategy strategy = CoinSelectionStrategy::AUTO;
+
+    /// Search time budget shared by all strategies
+    std::chrono::microseconds time_budget{50000};
+
+    /// Smallest change worth creating (0 = cost of spending it later)
+    uint64_t min_change = 0;
+};
+
+/// Coin selection result
+struct CoinSelectionResult {
+    std::vector<TxInputCoin> coins;
+    uint64_t total_in = 0;
+    uint64_t fee = 0;
+    uint64_t change = 0;   // 0 if no change output
+    size_t tx_size = 0;    // Estimated size including change output
+    CoinSelectionStrategy strategy = CoinSelectionStrategy::AUTO;  // Strategy that produced it
+};
+
+/// Spendable coins sorted by descending amount
+/// Built once per send and shared read-only by balance check, fee
+/// estimation, selection and signing
+class SortedUTXOIndex {
+public:
+    SortedUTXOIndex() = default;
+
+    /// Build index
+    /// @param coins Spendable coins in any order
+    explicit SortedUTXOIndex(std::vector<TxInputCoin> coins);
+
+    /// Coins by descending amount
+    const std::vector<TxInputCoin>& GetCoins() const { return coins_; }
+
+    /// Number of coins
+    size_t Size() const { return coins_.size(); }
+
+    /// Sum of all coin amounts
+    uint64_t GetTotal() const { return prefix_sums_.empty() ? 0 : prefix_sums_.back(); }
+
+    /// Fewest inputs that can cover an amount (largest coins first)
+    /// @param amount Amount in INTS
+    /// @return Input count, or Size() if the amount exceeds the total
+    size_t EstimateInputCount(uint64_t amount) const;
+
+private:
+    std::vector<TxInputCoin> coins_;
+    std::vector<uint64_t> prefix_sums_;  // prefix_sums_[i] = sum of coins_[0..i]
+};
+
+/// Select coins to fund a payment
+/// @param index Spendable coins
+/// @param params Selection parameters
+/// @return Selected coins with fee and change
+Result<CoinSelectionResult> SelectCoins(const SortedUTXOIndex& index,
+                                        const CoinSelectionParams& params);
+
+/// Strategy name for logs and reports
+const char* CoinSelectionStrategyName(CoinSelectionStrategy strategy);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_COIN_SELECTION_H
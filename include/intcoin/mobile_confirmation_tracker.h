@@ -0,0 +1,97 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_CONFIRMATION_TRACKER_H
+#define INTCOIN_MOBILE_CONFIRMATION_TRACKER_H
+
+#include <intcoin/mobile_memory.h>
+#include <intcoin/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// Confirmation change of a tracked transaction
+struct ConfirmationUpdate {
+    uint256 tx_hash;
+    uint64_t amount_ints;
+    uint32_t confirmations;  // Depth crossed (0 = back to pending after a reorg)
+    bool final;              // Deepest configured depth reached; no longer tracked
+};
+
+/// Follows pending transactions until they are buried deep enough
+/// Reports every configured depth a transaction crosses, in ascending
+/// order, including several at once after catching up. Fed either with
+/// block events or, where the sync layer raises none, by Refresh with
+/// the wallet's view of where each transaction was mined.
+class ConfirmationTracker {
+public:
+    /// Height of the block holding a transaction (0 = not in a block)
+    using BlockHeightFn = std::function<uint64_t(const uint256& tx_hash)>;
+
+    /// @param depths Confirmation depths to report (sorted and deduplicated;
+    ///               empty means report the first confirmation only)
+    /// @param memory Account charged for the tracked set (nullptr = untracked)
+    explicit ConfirmationTracker(std::vector<uint32_t> depths, MemoryAccount* memory = nullptr);
+
+    /// Start tracking a transaction
+    /// @param tx_hash Transaction hash
+    /// @param amount_ints Amount carried into updates
+    void Track(const uint256& tx_hash, uint64_t amount_ints);
+
+    /// Stop tracking a transaction
+    void Untrack(const uint256& tx_hash);
+
+    /// Block connected at the tip
+    /// @param height Block height
+    /// @param matched_txids Transactions in the block that matched the wallet filter
+    /// @return Depth crossings to report
+    std::vector<ConfirmationUpdate> BlockConnected(uint64_t height,
+                                                   const std::vector<uint256>& matched_txids);
+
+    /// Block disconnected from the tip
+    /// @param height Height of the removed block
+    /// @return Transactions that fell back to pending
+    std::vector<ConfirmationUpdate> BlockDisconnected(uint64_t height);
+
+    /// Re-read where every tracked transaction was mined
+    /// block_height is called without the tracker locked.
+    /// @param tip_height Current chain tip
+    /// @param block_height Lookup of a transaction's block height
+    /// @return Depth crossings, and transactions that fell back to pending
+    std::vector<ConfirmationUpdate> Refresh(uint64_t tip_height, const BlockHeightFn& block_height);
+
+    /// Number of tracked transactions
+    size_t GetTrackedCount() const;
+
+private:
+    struct Uint256Hasher {
+        size_t operator()(const uint256& hash) const;
+    };
+
+    struct Pending {
+        uint64_t amount_ints = 0;
+        uint64_t block_height = 0;  // 0 = not in a block
+        size_t next_depth = 0;      // Index into depths_ of the next report
+    };
+
+    std::vector<uint32_t> depths_;
+
+    mutable std::mutex mutex_;
+    TrackedUnorderedMap<uint256, Pending, Uint256Hasher> pending_;
+
+    /// Report the depths a transaction has crossed at a tip
+    /// @return True if the deepest depth was reached
+    bool Advance(const uint256& tx_hash, Pending& pending, uint64_t tip_height,
+                 std::vector<ConfirmationUpdate>* updates) const;
+};
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_CONFIRMATION_TRACKER_H
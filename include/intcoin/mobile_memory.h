@@ -0,0 +1,186 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_MEMORY_H
+#define INTCOIN_MOBILE_MEMORY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// SDK structures memory is accounted to
+enum class MemorySubsystem : uint8_t {
+    BLOOM_FILTER,    // Wallet filter loaded into the SPV client
+    UTXO_SET,        // Indexed wallet coins and their reorg undo data
+    HISTORY,         // Indexed wallet transaction history
+    ADDRESS_BOOK,    // Watched wallet scripts
+    PENDING_QUEUES,  // Outbound transactions and unconfirmed sends
+    COUNT
+};
+
+constexpr size_t MEMORY_SUBSYSTEM_COUNT = static_cast<size_t>(MemorySubsystem::COUNT);
+
+/// Subsystem name as used in reports (e.g. "utxo_set")
+const char* MemorySubsystemName(MemorySubsystem subsystem);
+
+/// Live heap bytes of one subsystem
+/// Updated with relaxed atomics, so containers on different threads can
+/// share an account without locking.
+class MemoryAccount {
+public:
+    MemoryAccount() = default;
+
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    void Allocated(size_t bytes);
+    void Freed(size_t bytes);
+
+    uint64_t GetBytes() const { return bytes_.load(std::memory_order_relaxed); }
+    uint64_t GetPeakBytes() const { return peak_bytes_.load(std::memory_order_relaxed); }
+
+    /// Live allocations
+    uint64_t GetBlocks() const { return blocks_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> peak_bytes_{0};
+    std::atomic<uint64_t> blocks_{0};
+};
+
+/// Standard allocator that charges every allocation to a MemoryAccount
+/// A default-constructed allocator charges nothing. The account travels
+/// with the container on copy, move and swap, so it must outlive every
+/// container using it.
+template <typename T>
+class TrackedAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    TrackedAllocator() noexcept = default;
+
+    explicit TrackedAllocator(MemoryAccount* account) noexcept : account_(account) {}
+
+    template <typename U>
+    TrackedAllocator(const TrackedAllocator<U>& other) noexcept : account_(other.GetAccount()) {}
+
+    T* allocate(size_t n) {
+        T* p = std::allocator<T>().allocate(n);
+        if (account_) {
+            account_->Allocated(n * sizeof(T));
+        }
+        return p;
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (account_) {
+            account_->Freed(n * sizeof(T));
+        }
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    MemoryAccount* GetAccount() const noexcept { return account_; }
+
+private:
+    MemoryAccount* account_ = nullptr;
+};
+
+template <typename T, typename U>
+bool operator==(const TrackedAllocator<T>& a, const TrackedAllocator<U>& b) noexcept {
+    return a.GetAccount() == b.GetAccount();
+}
+
+template <typename T, typename U>
+bool operator!=(const TrackedAllocator<T>& a, const TrackedAllocator<U>& b) noexcept {
+    return !(a == b);
+}
+
+template <typename T>
+using TrackedVector = std::vector<T, TrackedAllocator<T>>;
+
+template <typename T>
+using TrackedDeque = std::deque<T, TrackedAllocator<T>>;
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+using TrackedUnorderedMap =
+    std::unordered_map<K, V, Hash, std::equal_to<K>, TrackedAllocator<std::pair<const K, V>>>;
+
+template <typename K, typename V>
+using TrackedMap = std::map<K, V, std::less<K>, TrackedAllocator<std::pair<const K, V>>>;
+
+/// Share a byte buffer, charging it to an account for as long as any
+/// owner holds it (for buffers adopted from callers, which were not
+/// allocated through a TrackedAllocator)
+/// @param bytes Buffer to adopt
+/// @param account Account to charge (nullptr = untracked)
+std::shared_ptr<const std::vector<uint8_t>> MakeTrackedBuffer(std::vector<uint8_t> bytes,
+                                                              MemoryAccount* account);
+
+/// Usage of one subsystem
+struct MemorySubsystemUsage {
+    uint64_t bytes = 0;
+    uint64_t peak_bytes = 0;
+    uint64_t blocks = 0;
+};
+
+/// Memory report for one SDK instance
+struct MemoryUsage {
+    std::array<MemorySubsystemUsage, MEMORY_SUBSYSTEM_COUNT> subsystems{};  // In MemorySubsystem order
+
+    const MemorySubsystemUsage& Get(MemorySubsystem subsystem) const {
+        return subsystems[static_cast<size_t>(subsystem)];
+    }
+
+    uint64_t GetTotalBytes() const;
+};
+
+/// One account per subsystem
+/// Owned by whatever holds the tracked structures: the SDK for its own,
+/// and shared structures (such as a wallet's AddressIndex) for theirs.
+class MemoryTracker {
+public:
+    MemoryTracker() = default;
+
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+    MemoryAccount* Account(MemorySubsystem subsystem) {
+        return &accounts_[static_cast<size_t>(subsystem)];
+    }
+
+    /// Allocator charging a subsystem
+    template <typename T>
+    TrackedAllocator<T> Allocator(MemorySubsystem subsystem) {
+        return TrackedAllocator<T>(Account(subsystem));
+    }
+
+    /// Add this tracker's accounts to a report
+    void AddTo(MemoryUsage* usage) const;
+
+private:
+    std::array<MemoryAccount, MEMORY_SUBSYSTEM_COUNT> accounts_;
+};
+
+/// Render a report as one JSON object, e.g.
+/// {"total_bytes":N,"utxo_set":{"bytes":N,"peak_bytes":N,"blocks":N},...}
+std::string FormatMemoryUsageJSON(const MemoryUsage& usage);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_MEMORY_H
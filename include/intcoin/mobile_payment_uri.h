@@ -0,0 +1,78 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_PAYMENT_URI_H
+#define INTCOIN_MOBILE_PAYMENT_URI_H
+
+#include <intcoin/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace intcoin {
+namespace mobile {
+
+/// URI scheme for INTcoin payment requests
+constexpr std::string_view PAYMENT_URI_SCHEME = "intcoin:";
+
+/// Fields of a payment URI
+/// Views point into the parsed URI (address) or the caller's scratch
+/// buffer (decoded label and message); neither is copied.
+struct PaymentURIView {
+    std::string_view address;
+    uint64_t amount_ints = 0;  // 0 if the URI has no amount
+    std::string_view label;
+    std::string_view message;
+};
+
+/// Percent-encode a URI component (RFC 3986; only unreserved characters
+/// are left as they are)
+/// @param in Component text
+/// @param out Output buffer
+/// @param out_size Size of the output buffer
+/// @return Bytes written, or error if the buffer is too small
+Result<size_t> PercentEncode(std::string_view in, char* out, size_t out_size);
+
+/// Size of a component once percent-encoded
+size_t PercentEncodedSize(std::string_view in);
+
+/// Decode a percent-encoded URI component
+/// The decoded text is never longer than the input.
+/// @param in Encoded component
+/// @param out Output buffer
+/// @param out_size Size of the output buffer
+/// @return Bytes written, or error on a malformed escape or a short buffer
+Result<size_t> PercentDecode(std::string_view in, char* out, size_t out_size);
+
+/// Size of the payment URI for the given fields, excluding the terminator
+size_t PaymentURISize(std::string_view address, uint64_t amount_ints,
+                      std::string_view label, std::string_view message);
+
+/// Write a payment URI into a caller-provided buffer
+/// The amount is written in INT with trailing zeros dropped; label and
+/// message are percent-encoded. Output is NUL-terminated.
+/// @param out Output buffer (at least PaymentURISize() + 1 bytes)
+/// @param out_size Size of the output buffer
+/// @param address Receiving address (letters and digits only)
+/// @param amount_ints Amount in INTS (0 for none)
+/// @param label Payment label (empty for none)
+/// @param message Payment message (empty for none)
+/// @return URI length, or error if the buffer is too small or the address is malformed
+Result<size_t> BuildPaymentURI(char* out, size_t out_size,
+                               std::string_view address, uint64_t amount_ints,
+                               std::string_view label, std::string_view message);
+
+/// Parse a payment URI without allocating
+/// Unknown parameters are skipped, except "req-" ones, which the payer
+/// must understand and so make the URI unusable.
+/// @param uri Payment URI
+/// @param scratch Buffer for decoded label and message (uri.size() bytes is always enough)
+/// @param scratch_size Size of the scratch buffer
+/// @return Fields viewing uri and scratch
+Result<PaymentURIView> ParsePaymentURI(std::string_view uri, char* scratch, size_t scratch_size);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_PAYMENT_URI_H
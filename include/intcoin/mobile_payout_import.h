@@ -0,0 +1,241 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_PAYOUT_IMPORT_H
+#define INTCOIN_MOBILE_PAYOUT_IMPORT_H
+
+#include <intcoin/mobile_address_validation.h>
+#include <intcoin/mobile_signing.h>
+#include <intcoin/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+// ========================================
+// Payout Files
+// ========================================
+
+/// Payout file layout
+enum class PayoutFileFormat {
+    AUTO,  // JSON if the first non-blank character is '[' or '{', CSV otherwise
+    CSV,   // "address,amount[,...]" per line; optional header row, '#' comments
+    JSON,  // Array of {"address": ..., "amount": ...} objects, or one object per line
+};
+
+/// Longest CSV line or JSON object accepted, in bytes
+constexpr size_t MAX_PAYOUT_RECORD_SIZE = 4096;
+
+/// One payout as read from a file
+/// Amounts are in INT with up to six decimals ("1.5"), as users write them.
+struct PayoutRow {
+    uint64_t line = 0;      // 1-based line the record starts on
+    std::string address;
+    std::string amount;     // Amount as written
+    uint64_t amount_ints = 0;
+    std::string error;      // Why the row is rejected (empty if accepted)
+};
+
+/// Streams payout rows from a file in fixed-size reads
+/// Memory use is bounded by the read buffer and one record, whatever the
+/// file size.
+class PayoutFileReader {
+public:
+    /// Open a payout file
+    /// @param path File path
+    /// @param format File layout (AUTO detects it)
+    static Result<std::unique_ptr<PayoutFileReader>> Open(const std::string& path,
+                                                          PayoutFileFormat format = PayoutFileFormat::AUTO);
+
+    /// Read the next rows
+    /// Rows that cannot be split into address and amount are returned with
+    /// error set, so callers can report them by line.
+    /// @param max_rows Most rows to read
+    /// @param rows Replaced with the rows read
+    /// @return Number of rows read (0 at end of file), or error if the file
+    ///         cannot be read or is not well-formed JSON
+    Result<size_t> Read(size_t max_rows, std::vector<PayoutRow>* rows);
+
+    /// Format in use (resolved if opened with AUTO)
+    PayoutFileFormat GetFormat() const { return format_; }
+
+    /// Bytes consumed so far
+    uint64_t GetBytesRead() const { return bytes_read_; }
+
+    /// File size in bytes
+    uint64_t GetFileSize() const { return file_size_; }
+
+private:
+    PayoutFileReader() = default;
+
+    std::ifstream file_;
+    PayoutFileFormat format_ = PayoutFileFormat::CSV;
+    uint64_t file_size_ = 0;
+    uint64_t bytes_read_ = 0;
+
+    std::vector<char> buffer_;
+    size_t buffer_pos_ = 0;
+    size_t buffer_len_ = 0;
+    bool eof_ = false;
+
+    uint64_t line_ = 1;
+    bool header_checked_ = false;
+
+    /// Next byte, refilling the buffer as needed
+    /// @return False at end of file
+    bool NextByte(char* c);
+
+    /// Read one CSV line (without the newline)
+    /// @return False at end of file
+    bool NextLine(std::string* line, uint64_t* line_number, bool* too_long);
+
+    /// Read one top-level JSON object
+    /// @return Ok(false) at end of file
+    Result<bool> NextObject(std::string* object, uint64_t* line_number, bool* too_long);
+
+    void ParseCSVLine(const std::string& line, PayoutRow* row) const;
+    void ParseJSONObject(const std::string& object, PayoutRow* row) const;
+};
+
+// ========================================
+// Validation
+// ========================================
+
+/// Parse amounts and validate addresses of rows not already rejected
+/// Rows are split into slices run on the pool; addresses in a slice are
+/// checked with ValidateAddresses.
+/// @param rows Rows to check; error is set on rejected rows
+/// @param network Network the addresses must belong to
+/// @param pool Workers (nullptr = calling thread only)
+void ValidatePayoutRows(std::vector<PayoutRow>* rows, AddressNetwork network, WorkerPool* pool);
+
+/// Remembers payout addresses already seen
+/// Keeps a 64-bit hash per address rather than the address, so a file with
+/// a million recipients needs a few tens of megabytes. Case is ignored, as
+/// Bech32 addresses may be written in either.
+class PayoutDeduplicator {
+public:
+    /// Record an address
+    /// @return False if it was already recorded
+    bool Insert(std::string_view address);
+
+    void Clear() { seen_.clear(); }
+    size_t Size() const { return seen_.size(); }
+
+private:
+    std::unordered_set<uint64_t> seen_;
+};
+
+// ========================================
+// Import
+// ========================================
+
+/// Payout import options
+struct PayoutImportOptions {
+    /// File layout
+    PayoutFileFormat format = PayoutFileFormat::AUTO;
+
+    /// Rows read and validated per step
+    size_t chunk_rows = 4096;
+
+    /// Recipients per CreateBatchTransaction call
+    size_t batch_recipients = 1000;
+
+    /// Size cap per transaction in bytes (0 = one transaction per batch)
+    size_t max_tx_size = 100000;
+
+    /// Fee rate in INTS per KB (0 = auto estimate)
+    uint64_t fee_rate = 0;
+
+    /// Read the whole file once before sending, and send nothing unless
+    /// the wallet covers the total (and, with stop_on_invalid, every row
+    /// is valid)
+    bool verify_first = true;
+
+    /// Stop at the first rejected row instead of skipping it
+    bool stop_on_invalid = false;
+
+    /// Validate and total the file without creating transactions
+    bool dry_run = false;
+
+    /// Where paid rows are recorded (empty = the payout file path plus
+    /// ".paid"). A rerun skips rows recorded there; delete it to pay the
+    /// same file again.
+    std::string resume_path;
+};
+
+/// Payout import progress
+struct PayoutImportProgress {
+    uint64_t bytes_read = 0;
+    uint64_t total_bytes = 0;
+    uint64_t rows_read = 0;
+    uint64_t rows_accepted = 0;
+    uint64_t rows_rejected = 0;      // Including duplicates
+    uint64_t duplicates = 0;
+    uint64_t amount_accepted = 0;    // INTS
+    uint64_t rows_paid_before = 0;   // Accepted rows a previous run paid
+    uint64_t amount_paid_before = 0; // INTS
+    uint64_t estimated_fees = 0;     // INTS, for the rows still to pay (verify pass)
+    uint64_t transactions_sent = 0;
+    bool verifying = false;          // True during the verify_first pass
+};
+
+/// Rejected payout row
+struct PayoutRejection {
+    uint64_t line;
+    std::string address;
+    std::string reason;
+};
+
+/// Most rejections kept in a summary (all are counted)
+constexpr size_t MAX_REPORTED_REJECTIONS = 1000;
+
+/// Payout import result
+struct PayoutImportSummary {
+    PayoutImportProgress totals;
+    std::vector<uint256> tx_hashes;
+    std::vector<PayoutRejection> rejections;
+};
+
+/// Payout import progress callback (called after every chunk)
+using PayoutProgressCallback = std::function<void(const PayoutImportProgress&)>;
+
+/// Rows of a payout file already paid, in file order
+/// Saved after every transaction sent, so an import that stops part way
+/// (or is run again) resumes after the last payment instead of repeating
+/// it. The fingerprint ties the record to the rows it covers.
+struct PayoutResumePoint {
+    uint64_t rows_paid = 0;          // Accepted rows
+    uint64_t amount_paid = 0;        // INTS
+    uint64_t transactions_sent = 0;
+    uint64_t fingerprint = 0;        // PayoutFingerprint over the paid rows
+};
+
+/// Fingerprint of no rows
+constexpr uint64_t PAYOUT_FINGERPRINT_INIT = 14695981039346656037ULL;
+
+/// Add an accepted row (line, address and amount) to a running fingerprint
+uint64_t PayoutFingerprint(uint64_t fingerprint, const PayoutRow& row);
+
+/// Read a resume point
+/// @param path Resume file
+/// @return Resume point (nothing paid if the file does not exist), or
+///         error if the file exists but cannot be read
+Result<PayoutResumePoint> LoadPayoutResumePoint(const std::string& path);
+
+/// Replace a resume point (written to a temporary file, then renamed)
+Result<void> SavePayoutResumePoint(const std::string& path, const PayoutResumePoint& point);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_PAYOUT_IMPORT_H
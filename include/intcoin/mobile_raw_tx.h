@@ -0,0 +1,76 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_RAW_TX_H
+#define INTCOIN_MOBILE_RAW_TX_H
+
+#include <intcoin/transaction.h>
+#include <intcoin/types.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace intcoin {
+namespace mobile {
+
+/// Largest raw transaction accepted for relay
+constexpr size_t MAX_RAW_TX_SIZE = 4 * 1024 * 1024;
+
+/// Read-only view of a serialized transaction
+/// Parse() checks the wire layout written by Transaction::Serialize in one
+/// pass without allocating or copying, and hashes the bytes once for the
+/// txid. The view points into the caller's buffer, which must outlive it.
+/// The layout is restated here rather than taken from the core; debug
+/// builds check bytes entering the SDK against it with CheckViewMatchesCore.
+///
+/// Layout: version (4), input count (compact size), per input prev hash
+/// (32), prev index (4), signature and public key (compact size + bytes
+/// each), sequence (4); output count, per output value (8) and script
+/// (compact size + bytes); locktime (4).
+class RawTransactionView {
+public:
+    /// Validate structure and compute txid
+    /// @param data Serialized transaction
+    /// @param size Size in bytes
+    /// @return View over data
+    static Result<RawTransactionView> Parse(const uint8_t* data, size_t size);
+
+    /// Serialized bytes
+    const uint8_t* GetData() const { return data_; }
+    size_t GetSize() const { return size_; }
+
+    uint32_t GetVersion() const { return version_; }
+    uint32_t GetLocktime() const { return locktime_; }
+    size_t GetInputCount() const { return input_count_; }
+    size_t GetOutputCount() const { return output_count_; }
+
+    /// Sum of output values in INTS
+    uint64_t GetTotalOutput() const { return total_output_; }
+
+    /// Transaction hash (SHA3-256 of the serialized bytes)
+    const uint256& GetHash() const { return hash_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    uint32_t version_ = 0;
+    uint32_t locktime_ = 0;
+    size_t input_count_ = 0;
+    size_t output_count_ = 0;
+    uint64_t total_output_ = 0;
+    uint256 hash_{};
+};
+
+/// Check that the core reads a view's bytes the same way
+/// Transaction::Serialize must reproduce the bytes exactly and GetHash must
+/// equal the view's txid; otherwise the SDK would queue and track a txid
+/// the node does not know.
+/// @param view Parsed view
+/// @param tx Transaction::Deserialize of the same bytes
+/// @return Error naming the first mismatch
+Result<void> CheckViewMatchesCore(const RawTransactionView& view, const Transaction& tx);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_RAW_TX_H
@@ -0,0 +1,50 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_RPC_CONTEXT_H
+#define INTCOIN_MOBILE_RPC_CONTEXT_H
+
+#include <intcoin/mobile_chain_tip.h>
+
+#include <memory>
+
+namespace intcoin {
+namespace mobile {
+
+class AddressIndex;
+
+/// SDK state a MobileRPC call reads besides its wallet and SPV client
+/// MobileRPC is built from those two alone, so the SDK that owns the rest
+/// hands it in for the duration of each call instead of the RPC looking
+/// it up in a process-wide registry.
+struct RPCContext {
+    /// Tip published by the sync layer (null = read the SPV client)
+    const ChainTipPublisher* chain_tip = nullptr;
+
+    /// Index over the wallet's scripts (null = built from the wallet when
+    /// a call needs it)
+    std::shared_ptr<const AddressIndex> address_index;
+};
+
+/// Makes a context current on this thread while in scope
+/// Scopes nest; the innermost one wins.
+class RPCContextScope {
+public:
+    explicit RPCContextScope(const RPCContext& context);
+    ~RPCContextScope();
+
+    RPCContextScope(const RPCContextScope&) = delete;
+    RPCContextScope& operator=(const RPCContextScope&) = delete;
+
+    /// Context of the innermost scope on this thread (empty outside any)
+    static const RPCContext& Current();
+
+private:
+    RPCContext context_;
+    const RPCContext* previous_;
+};
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_RPC_CONTEXT_H
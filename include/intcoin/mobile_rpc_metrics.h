@@ -0,0 +1,178 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_RPC_METRICS_H
+#define INTCOIN_MOBILE_RPC_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// Instrumented MobileRPC methods
+enum class RPCMethod : uint8_t {
+    SYNC,              // Payload: headers returned (MobileSDK: gained per sync poll)
+    GET_BALANCE,       // Payload: UTXOs counted
+    GET_HISTORY,       // Payload: entries returned
+    SEND_TRANSACTION,  // Payload: raw transaction bytes
+    GET_UTXOS,         // Payload: UTXOs returned
+    ESTIMATE_FEE,      // Payload: transaction size estimated, in bytes
+    COUNT
+};
+
+constexpr size_t RPC_METHOD_COUNT = static_cast<size_t>(RPCMethod::COUNT);
+
+/// Method name as used in exported metrics (e.g. "get_balance")
+const char* RPCMethodName(RPCMethod method);
+
+/// Whether a method's payload is a size in bytes rather than a count of items
+bool RPCPayloadIsBytes(RPCMethod method);
+
+/// Point-in-time copy of a LogLinearHistogram
+struct HistogramSnapshot {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets;
+
+    /// Value at a percentile, to within the bucket precision
+    /// @param percentile 0.0 to 100.0
+    /// @return Value (0 if nothing was recorded)
+    uint64_t ValueAtPercentile(double percentile) const;
+
+    double Mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+};
+
+/// Lock-free log-linear histogram (HdrHistogram layout)
+/// Each power of two is split into 16 equal buckets, so any recorded value
+/// is reported within 1/32 of its true value. Values up to 2^41 are kept
+/// apart; larger ones share the top bucket. Recording is a few relaxed
+/// atomic adds and never blocks.
+class LogLinearHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;
+    static constexpr int MAX_EXPONENT = 40;
+    static constexpr size_t BUCKET_COUNT =
+        static_cast<size_t>(MAX_EXPONENT - SUB_BUCKET_BITS + 2) << SUB_BUCKET_BITS;
+
+    LogLinearHistogram() = default;
+
+    LogLinearHistogram(const LogLinearHistogram&) = delete;
+    LogLinearHistogram& operator=(const LogLinearHistogram&) = delete;
+
+    void Record(uint64_t value);
+
+    HistogramSnapshot Snapshot() const;
+
+    void Reset();
+
+    /// Bucket holding a value
+    static size_t BucketIndex(uint64_t value);
+
+    /// Smallest value in a bucket
+    static uint64_t BucketLowerBound(size_t index);
+
+    /// Largest value in a bucket
+    static uint64_t BucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+/// Counters and distributions for one method
+struct RPCMethodMetrics {
+    RPCMethod method = RPCMethod::SYNC;
+    uint64_t calls = 0;
+    uint64_t errors = 0;
+    HistogramSnapshot latency_ns;
+    HistogramSnapshot payload;
+};
+
+/// Snapshot of every instrumented method
+struct RPCMetricsSnapshot {
+    std::vector<RPCMethodMetrics> methods;  // In RPCMethod order
+};
+
+/// Per-method call instrumentation shared by every MobileRPC handler in
+/// the process, so a server running one handler per wallet reports the
+/// load on the whole process.
+class RPCMetrics {
+public:
+    /// Process-wide instance
+    static RPCMetrics& Global();
+
+    /// Record one completed call
+    /// @param method Method called
+    /// @param latency_ns Time spent in the call
+    /// @param ok False if the call failed or the request was rejected
+    /// @param payload Method payload size (see RPCMethod)
+    void Record(RPCMethod method, uint64_t latency_ns, bool ok, uint64_t payload);
+
+    RPCMetricsSnapshot Snapshot() const;
+
+    void Reset();
+
+private:
+    struct MethodState {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> errors{0};
+        LogLinearHistogram latency_ns;
+        LogLinearHistogram payload;
+    };
+
+    std::array<MethodState, RPC_METHOD_COUNT> methods_;
+};
+
+/// Times one RPC call and records it when the scope ends
+/// The call counts as an error unless Succeeded() is reached, so every
+/// early return is covered.
+class RPCCallScope {
+public:
+    /// @param method Method being called
+    /// @param payload Payload size known up front (kept if the call fails)
+    explicit RPCCallScope(RPCMethod method, uint64_t payload = 0)
+        : method_(method), payload_(payload), start_(std::chrono::steady_clock::now()) {}
+
+    ~RPCCallScope() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        RPCMetrics::Global().Record(
+            method_, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            ok_, payload_);
+    }
+
+    RPCCallScope(const RPCCallScope&) = delete;
+    RPCCallScope& operator=(const RPCCallScope&) = delete;
+
+    /// Mark the call successful
+    /// @param payload Payload size of the response
+    void Succeeded(uint64_t payload) {
+        ok_ = true;
+        payload_ = payload;
+    }
+
+private:
+    RPCMethod method_;
+    uint64_t payload_;
+    bool ok_ = false;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Render metrics in the Prometheus text exposition format (0.0.4)
+/// Calls and errors are counters; latency (in seconds) and payload are
+/// summaries with 0.5, 0.9, 0.99 and 0.999 quantiles, plus a max gauge.
+/// Payloads are split by unit: intcoin_rpc_payload_items for methods that
+/// count headers, UTXOs or entries, intcoin_rpc_payload_bytes for the rest.
+std::string FormatPrometheusMetrics(const RPCMetricsSnapshot& metrics);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_RPC_METRICS_H
@@ -5,15 +5,32 @@
 #define INTCOIN_MOBILE_SDK_H
 
 #include <intcoin/bloom.h>
+#include <intcoin/mobile_address_index.h>
+#include <intcoin/mobile_broadcast_queue.h>
+#include <intcoin/mobile_chain_tip.h>
+#include <intcoin/mobile_coin_selection.h>
+#include <intcoin/mobile_confirmation_tracker.h>
+#include <intcoin/mobile_memory.h>
+#include <intcoin/mobile_payout_import.h>
+#include <intcoin/mobile_raw_tx.h>
 #include <intcoin/mobile_rpc.h>
+#include <intcoin/mobile_rpc_context.h>
+#include <intcoin/mobile_rpc_metrics.h>
+#include <intcoin/mobile_signing.h>
+#include <intcoin/mobile_wallet_snapshot.h>
 #include <intcoin/spv.h>
 #include <intcoin/transaction.h>
 #include <intcoin/types.h>
 #include <intcoin/wallet.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace intcoin {
@@ -38,6 +55,38 @@ struct SDKConfig {
 
     /// Number of addresses to watch in bloom filter
     uint32_t bloom_filter_addresses = 100;
+
+    /// Open the SPV database on a background thread right after construction
+    /// (otherwise it is opened on first use)
+    bool background_warmup = false;
+
+    /// Write a wallet snapshot every N synced blocks (0 = only on close)
+    uint32_t snapshot_interval_blocks = 1000;
+
+    /// Interval between polls of the SPV client while sync runs; each poll
+    /// reports progress and writes snapshots when due
+    uint32_t sync_poll_ms = 1000;
+
+    /// Coin selection strategy for CreateTransaction
+    CoinSelectionStrategy coin_selection = CoinSelectionStrategy::AUTO;
+
+    /// Coin selection time budget in milliseconds
+    uint32_t coin_selection_budget_ms = 50;
+
+    /// Confirmation depths reported for sent transactions
+    std::vector<uint32_t> confirmation_depths = {1, 6};
+
+    /// Peers a queued transaction is relayed to in parallel
+    uint32_t broadcast_fanout = 3;
+
+    /// Threads for CPU-bound batch work: payout address validation
+    /// (0 = one per core, 1 = calling thread only). Wallet signing always
+    /// runs on the calling thread.
+    uint32_t signing_threads = 0;
+
+    /// Record trace spans for the sync and send pipelines, keeping the
+    /// newest N events (0 = tracing off; see intcoin_sdk_trace_dump)
+    size_t trace_events = 0;
 };
 
 /// Transaction event types
@@ -66,6 +115,13 @@ struct SyncProgress {
     bool is_syncing;
 };
 
+/// Startup phase timing entry
+struct StartupPhase {
+    std::string name;
+    uint64_t duration_us;
+    bool on_caller_thread;  // False if the phase ran during background warm-up
+};
+
 /// Mobile SDK for INTcoin lightweight wallet clients
 /// Provides high-level API for mobile wallet applications
 class MobileSDK {
@@ -77,6 +133,18 @@ public:
     /// Destructor
     ~MobileSDK();
 
+    // ========================================
+    // Initialization
+    // ========================================
+
+    /// Start background warm-up of the SPV database and client
+    /// Safe to call more than once; subsystems are otherwise created on first use
+    void WarmUp();
+
+    /// Get cold-start timing report
+    /// @return Startup phases in the order they completed
+    std::vector<StartupPhase> GetStartupReport() const;
+
     // ========================================
     // Wallet Management
     // ========================================
@@ -88,6 +156,10 @@ public:
     Result<std::string> CreateWallet(const std::string& mnemonic, const std::string& password);
 
     /// Open existing wallet
+    /// If the wallet snapshot was taken from the wallet file as it is on
+    /// disk, reads are served from it at once and the wallet itself loads
+    /// in the background; calls that need the wallet wait for that load,
+    /// and a wrong password is reported by the first of them.
     /// @param password Wallet encryption password
     /// @return Success/failure result
     Result<void> OpenWallet(const std::string& password);
@@ -134,7 +206,7 @@ public:
     // Balance & UTXO Management
     // ========================================
 
-    /// Get wallet balance
+    /// Get wallet balance, totalled across all wallet addresses
     /// @return Balance in INTS (1 INT = 1,000,000 INTS)
     Result<BalanceResponse> GetBalance();
 
@@ -156,13 +228,51 @@ public:
                                           uint64_t amount_ints,
                                           uint64_t fee_rate = 0);
 
+    /// Create and sign batched payout transactions
+    /// Inputs are chosen once for the whole batch; with a size cap the
+    /// recipients are split across as few transactions as fit
+    /// @param recipients Payment recipients
+    /// @param fee_rate Fee rate in INTS per KB (0 = auto estimate)
+    /// @param max_tx_size Size cap per transaction in bytes (0 = single transaction)
+    /// @return Signed transactions ready to broadcast
+    Result<std::vector<Transaction>> CreateBatchTransaction(const std::vector<TxRecipient>& recipients,
+                                                            uint64_t fee_rate = 0,
+                                                            size_t max_tx_size = 0);
+
+    /// Import a payout file and send its payments in batched transactions
+    /// The file is streamed a chunk at a time: rows are validated in
+    /// parallel, repeated addresses are rejected, and accepted payouts are
+    /// paid batch_recipients at a time, so memory use does not grow with
+    /// the file. Rejected rows are skipped unless stop_on_invalid is set.
+    /// @param path Payout file (CSV or JSON)
+    /// @param options Import options
+    /// @param progress Called after every chunk (may be empty)
+    /// Change from each transaction funds later ones. Paid rows are
+    /// recorded (options.resume_path) before each transaction is sent, so
+    /// running the import again after a failure, or after it finished,
+    /// pays only the rows not yet paid.
+    /// @return Summary, or error if the file cannot be read, verification
+    ///         fails, or a batch cannot be created or sent (transactions sent
+    ///         before the failure are not undone; the error says how many)
+    Result<PayoutImportSummary> ImportPayouts(const std::string& path,
+                                              const PayoutImportOptions& options = PayoutImportOptions{},
+                                              PayoutProgressCallback progress = nullptr);
+
     /// Broadcast transaction to network
     /// @param tx Transaction to broadcast
     /// @return Result with transaction hash
     Result<uint256> SendTransaction(const Transaction& tx);
 
+    /// Broadcast serialized transaction to network
+    /// The bytes are checked and hashed in place, journaled, and relayed
+    /// unchanged from the broadcast queue until a peer acknowledges them
+    /// @param raw_tx Serialized transaction
+    /// @return Result with transaction hash once queued, or error if SPV is
+    ///         disabled (there are no peers to relay to)
+    Result<uint256> SendRawTransaction(std::vector<uint8_t> raw_tx);
+
     /// Get transaction history
-    /// @param limit Maximum number of transactions
+    /// @param limit Maximum number of transactions (at least 1)
     /// @param offset Offset for pagination
     /// @return Transaction history
     Result<HistoryResponse> GetTransactionHistory(uint32_t limit = 50, uint32_t offset = 0);
@@ -196,6 +306,10 @@ public:
     /// @return True if sync in progress
     bool IsSyncing() const;
 
+    /// Get chain tip
+    /// @return Height, hash and work of one consistent tip
+    ChainTip GetChainTip() const;
+
     /// Get sync progress
     /// @return Current sync status
     SyncProgress GetSyncProgress() const;
@@ -204,6 +318,43 @@ public:
     /// @return Network information
     Result<MobileRPC::NetworkStatus> GetNetworkStatus();
 
+    /// Block connected at the chain tip (called by the sync layer)
+    /// Publishes the new tip, applies the block to the address index,
+    /// advances tracked transactions and emits CONFIRMED events as they
+    /// reach each configured depth
+    /// @param height Block height
+    /// @param block_hash Block hash
+    /// @param matched_txs Transactions in the block that matched the wallet filter
+    /// @param chain_work Cumulative chain work at the block (zero if unknown)
+    void NotifyBlockConnected(uint64_t height,
+                              const uint256& block_hash,
+                              const std::vector<Transaction>& matched_txs,
+                              const uint256& chain_work = uint256{});
+
+    /// Block disconnected from the chain tip (called by the sync layer)
+    /// The block is undone in the address index and transactions that were
+    /// in it are reported PENDING again
+    /// @param height Height of the removed block
+    /// @param block_hash Hash of the removed block
+    void NotifyBlockDisconnected(uint64_t height, const uint256& block_hash);
+
+    /// Get outbound broadcast queue metrics
+    /// @return Queue depth, attempts and relay/acknowledgement latency
+    BroadcastMetrics GetBroadcastMetrics();
+
+    /// Get RPC call metrics
+    /// Counts, errors, latency and payload distributions for each
+    /// instrumented MobileRPC method, across every handler in the process
+    /// @return Snapshot (FormatPrometheusMetrics renders it for scraping)
+    RPCMetricsSnapshot GetMetrics() const;
+
+    /// Get memory held by this instance, per subsystem
+    /// Bloom filter, UTXO set, history, address book and pending queues;
+    /// the UTXO set, history and address book belong to the wallet's
+    /// index, which RPC handlers for the same wallet share.
+    /// @return Live and peak bytes (FormatMemoryUsageJSON renders it)
+    MemoryUsage GetMemoryUsage() const;
+
     // ========================================
     // QR Code Support
     // ========================================
@@ -213,7 +364,7 @@ public:
     /// @param amount_ints Amount in INTS (optional)
     /// @param label Payment label (optional)
     /// @param message Payment message (optional)
-    /// @return intcoin: URI for QR code
+    /// @return intcoin: URI for QR code, percent-encoded (empty if the address is malformed)
     static std::string GeneratePaymentURI(const std::string& address,
                                          uint64_t amount_ints = 0,
                                          const std::string& label = "",
@@ -253,7 +404,7 @@ public:
 
     /// Parse INT amount to INTS
     /// @param amount_str Amount string (e.g., "1.5" or "1500000")
-    /// @return Amount in INTS
+    /// @return Amount in INTS, or error if malformed, finer than one INTS or out of range
     static Result<uint64_t> ParseINTAmount(const std::string& amount_str);
 
     /// Get SDK version
@@ -264,19 +415,42 @@ private:
     /// SDK configuration
     SDKConfig config_;
 
+    /// Memory accounts for structures owned by this instance
+    /// (declared early so it outlives everything charged to it)
+    MemoryTracker memory_;
+
+    /// Bytes charged for the bloom filter loaded into the SPV client
+    size_t bloom_filter_bytes_ = 0;
+
+    /// Guards lazy creation of db_, spv_client_ and rpc_
+    mutable std::mutex init_mutex_;
+
+    /// Background warm-up thread
+    std::thread warmup_thread_;
+
+    /// Thread that constructed the SDK (used to attribute startup phases)
+    std::thread::id caller_thread_;
+
+    /// Cold-start timing report
+    mutable std::mutex startup_mutex_;
+    std::vector<StartupPhase> startup_phases_;
+
     /// Wallet instance
     std::shared_ptr<wallet::Wallet> wallet_;
 
     /// SPV client for lightweight sync
     std::shared_ptr<SPVClient> spv_client_;
 
+    /// Tip published by the sync monitor and block hooks, read by requests
+    ChainTipPublisher chain_tip_;
+
     /// Mobile RPC handler
     std::shared_ptr<MobileRPC> rpc_;
 
     /// Database backend
     std::shared_ptr<BlockchainDB> db_;
 
-    /// Transaction event callback
+    /// Transaction event callback (guarded by sync_monitor_mutex_)
     std::function<void(const TxEvent&)> tx_callback_;
 
     /// Sync progress callback
@@ -285,14 +459,205 @@ private:
     /// Wallet open state
     bool wallet_open_;
 
+    /// Sent transactions awaiting their confirmation depths
+    ConfirmationTracker confirmation_tracker_;
+
+    /// Tip the tracked transactions were last checked at (sync monitor only)
+    ChainTip confirmations_tip_{};
+
+    /// Height at the previous sync poll, for the sync metrics (sync monitor only)
+    uint64_t sync_poll_height_ = 0;
+
+    /// Guards snapshot_, snapshot_checked_ and last_snapshot_height_
+    mutable std::mutex snapshot_mutex_;
+
+    /// Mapped wallet snapshot (null once wallet state moves past it)
+    std::shared_ptr<WalletSnapshot> snapshot_;
+
+    /// Snapshot checked against the SPV client's tip since the wallet opened
+    bool snapshot_checked_ = false;
+
+    /// Chain height of the last snapshot written or loaded
+    uint64_t last_snapshot_height_ = 0;
+
+    /// Held for every use of wallet_ (and of the RPC handler's copy): open,
+    /// close, reads that reach the wallet, signing and each sync poll.
+    /// Recursive because public calls nest; taken before init_mutex_ and
+    /// snapshot_mutex_, and never held while a callback runs.
+    std::recursive_mutex wallet_mutex_;
+
+    /// Background wallet load started by OpenWallet (invalid when the
+    /// wallet was loaded on the caller thread)
+    std::mutex wallet_load_mutex_;
+    std::shared_future<Result<void>> wallet_load_;
+
+    /// Polls the SPV client while sync runs (started by StartSync)
+    std::thread sync_monitor_;
+    std::mutex sync_monitor_mutex_;
+    std::condition_variable sync_monitor_cv_;
+    bool sync_monitor_stop_ = false;
+
+    /// Workers for payout validation (created on first use)
+    std::unique_ptr<WorkerPool> signing_pool_;
+
+    /// Durable outbound transaction queue (created on first use)
+    std::unique_ptr<BroadcastQueue> broadcast_queue_;
+
+    /// Script hash index over wallet addresses, handed to RPC calls
+    /// (built from the wallet on first use, rebuilt when the tip moves)
+    std::shared_ptr<AddressIndex> address_index_;
+
+    /// Tip the address index was built at
+    ChainTip address_index_tip_{};
+
+    /// Sent transactions not yet mined, applied on top of each rebuild
+    std::vector<Transaction> unconfirmed_sends_;
+
+    /// Get SPV client, creating the database and client on first use
+    /// @return SPV client, or nullptr if SPV is disabled
+    std::shared_ptr<SPVClient> GetSPVClient();
+
+    /// Get SPV client without creating it
+    std::shared_ptr<SPVClient> PeekSPVClient() const;
+
+    /// Get RPC handler, creating it on first use
+    std::shared_ptr<MobileRPC> GetRPC();
+
+    /// Drop RPC handler so it is rebuilt against the current wallet
+    void ResetRPC();
+
+    /// Record a completed startup phase
+    void RecordStartupPhase(const char* name, std::chrono::steady_clock::time_point start);
+
+    /// Take a read-only view of the wallet's spendable coins
+    /// @param min_confirmations Minimum confirmations required
+    /// @return Coins sorted for selection
+    Result<std::shared_ptr<const SortedUTXOIndex>> TakeUTXOSnapshot(uint32_t min_confirmations);
+
+    /// Use given fee rate, or estimate one for the payment
+    Result<uint64_t> ResolveFeeRate(const SortedUTXOIndex& utxos, uint64_t amount_ints,
+                                    size_t num_outputs, uint64_t fee_rate);
+
+    /// Run coin selection with the configured strategy and budget
+    Result<CoinSelectionResult> SelectInputs(const SortedUTXOIndex& utxos, uint64_t amount_ints,
+                                             size_t num_outputs, uint64_t fee_rate);
+
+    /// Create and sign batched transactions from a coin pool
+    /// @param coins Coins to spend; replaced with the coins left afterwards
+    ///              plus the (unconfirmed) change of the new transactions
+    /// @param group_sizes Set to the recipients paid by each transaction,
+    ///                    in order (optional)
+    Result<std::vector<Transaction>> CreateBatchFromPool(std::shared_ptr<const SortedUTXOIndex>* coins,
+                                                         const std::vector<TxRecipient>& recipients,
+                                                         uint64_t total_amount,
+                                                         uint64_t fee_rate,
+                                                         size_t max_tx_size,
+                                                         std::vector<size_t>* group_sizes = nullptr);
+
+    /// Fees for paying recipients in batches as ImportPayouts does
+    /// An estimate: each transaction is assumed to fill up to the size cap
+    /// and to spend the change of the one before.
+    Result<uint64_t> EstimatePayoutFees(const SortedUTXOIndex& coins, uint64_t amount_ints,
+                                        uint64_t recipients, const PayoutImportOptions& options);
+
+    /// Build an unsigned transaction from a selection
+    Result<Transaction> BuildFromSelection(const CoinSelectionResult& selection,
+                                           const std::vector<TxRecipient>& recipients);
+
+    /// Sign transactions with the wallet, one at a time under wallet_mutex_
+    Result<std::vector<Transaction>> SignTransactionBatch(const std::vector<Transaction>& txs);
+
+    /// Queue a parsed transaction and record it as sent
+    /// @param raw_tx Serialized transaction
+    /// @param view View parsed over raw_tx's buffer
+    /// @param tx The same transaction as the core reads it
+    /// @return Transaction hash once journaled
+    Result<uint256> QueueTransaction(std::vector<uint8_t> raw_tx, const RawTransactionView& view,
+                                     const Transaction& tx);
+
+    /// Get broadcast queue, loading its journal and starting it on first use
+    /// @return Queue, or nullptr if SPV is disabled
+    BroadcastQueue* GetBroadcastQueue();
+
+    /// Get address index, building it from the wallet on first use
+    /// @return Index, or nullptr if no wallet is open
+    std::shared_ptr<AddressIndex> GetAddressIndex();
+
+    /// Build the address index from the wallet at a tip (wallet_mutex_ and
+    /// init_mutex_ held)
+    void BuildAddressIndex(const ChainTip& tip);
+
+    /// Rebuild the address index once the tip moves (if one was built)
+    void RefreshAddressIndex();
+
+    /// Get the batch worker pool, creating it on first use
+    /// @return Worker pool, or nullptr when working on the calling thread
+    WorkerPool* GetSigningPool();
+
+    /// Wallet snapshot file path
+    std::string GetSnapshotPath() const;
+
+    /// Path of the record tying the snapshot to its tip and wallet file
+    std::string GetSnapshotTipPath() const;
+
+    /// Record the snapshot tip and the wallet file as it is now on disk
+    Result<void> SaveSnapshotTip(const ChainTip& tip);
+
+    /// Map the snapshot if its tip record matches it and the wallet file,
+    /// and publish its tip when none is known; needs no SPV client
+    /// @return True if the snapshot is in place
+    bool LoadSnapshotOffline();
+
+    /// Wait for a background wallet load (wallet_mutex_ held)
+    /// @return Ok once the wallet is loaded (at once if it was not deferred),
+    ///         or error if it failed or no wallet is open
+    Result<void> AwaitWalletLoad();
+
+    /// Get the wallet snapshot, checking it against the SPV client's tip
+    /// the first time one is up (one is never created for it)
+    /// @return Snapshot, or nullptr if there is none or it is stale
+    std::shared_ptr<WalletSnapshot> GetSnapshot();
+
+    /// Drop the wallet snapshot once wallet state has moved past it
+    void ResetSnapshot();
+
+    /// Write wallet snapshot and its tip record for the current chain tip
+    Result<void> WriteWalletSnapshot();
+
     /// Update bloom filter with wallet addresses
     void UpdateBloomFilter();
 
     /// Process transaction event
     void ProcessTransactionEvent(const TxEvent& event);
 
+    /// Raise CONFIRMED or PENDING events for tracked transactions
+    void ReportConfirmationUpdates(const std::vector<ConfirmationUpdate>& updates);
+
+    /// Check tracked transactions against the wallet once the tip moves
+    /// @return Updates for ReportConfirmationUpdates, raised once wallet_mutex_
+    ///         is released
+    std::vector<ConfirmationUpdate> RefreshConfirmations();
+
+    /// Outputs of a transaction not paying back to the wallet, in INTS
+    uint64_t AmountSentBy(const Transaction& tx);
+
     /// Update sync progress
     void UpdateSyncProgress();
+
+    /// Publish the SPV client's tip if it moved
+    void PublishChainTip();
+
+    /// State handed to RPC calls made by this SDK
+    RPCContext GetRPCContext() const;
+
+    /// Start polling the SPV client (no-op if already polling)
+    void StartSyncMonitor();
+
+    /// Stop polling and wait for the poll in progress
+    void StopSyncMonitor();
+
+    /// Sync monitor thread body
+    void SyncMonitorLoop();
 };
 
 }  // namespace mobile
@@ -322,6 +687,10 @@ intcoin_sdk_t intcoin_sdk_create(const char* network,
 /// @param sdk SDK handle
 void intcoin_sdk_destroy(intcoin_sdk_t sdk);
 
+/// Start background warm-up (call after the first frame is drawn)
+/// @param sdk SDK handle
+void intcoin_sdk_warm_up(intcoin_sdk_t sdk);
+
 /// Create new wallet
 /// @param sdk SDK handle
 /// @param password Wallet password
@@ -367,6 +736,74 @@ int intcoin_sdk_send_transaction(intcoin_sdk_t sdk,
                                   uint64_t amount_ints,
                                   uint8_t* tx_hash_out);
 
+/// Send serialized transaction
+/// @param sdk SDK handle
+/// @param raw_tx Serialized signed transaction
+/// @param raw_tx_len Size of raw_tx in bytes
+/// @param tx_hash_out Output buffer for tx hash (32 bytes)
+/// @return 0 on success, error code otherwise
+int intcoin_sdk_send_raw_transaction(intcoin_sdk_t sdk,
+                                     const uint8_t* raw_tx,
+                                     size_t raw_tx_len,
+                                     uint8_t* tx_hash_out);
+
+/// Send batched payout
+/// @param sdk SDK handle
+/// @param addresses Recipient addresses
+/// @param amounts Amounts in INTS
+/// @param count Number of recipients
+/// @param max_tx_size Size cap per transaction in bytes (0 = single transaction)
+/// @param tx_hashes_out Output buffer for tx hashes (32 bytes each)
+/// @param tx_hashes_capacity Hashes tx_hashes_out can hold; nothing is sent
+///        if the batch needs more transactions (count always suffices)
+/// @param tx_count_out Number of transactions sent (0 on any early failure)
+/// @return 0 on success, error code otherwise
+int intcoin_sdk_send_batch(intcoin_sdk_t sdk,
+                           const char* const* addresses,
+                           const uint64_t* amounts,
+                           size_t count,
+                           size_t max_tx_size,
+                           uint8_t* tx_hashes_out,
+                           size_t tx_hashes_capacity,
+                           size_t* tx_count_out);
+
+/// Payout import progress callback
+/// @param bytes_read Bytes of the file processed so far
+/// @param total_bytes File size
+/// @param rows_accepted Payouts accepted so far
+/// @param rows_rejected Payouts rejected so far
+/// @param transactions_sent Transactions sent so far
+/// @param user_data Pointer passed to intcoin_sdk_import_payouts
+typedef void (*intcoin_payout_progress_cb)(uint64_t bytes_read,
+                                           uint64_t total_bytes,
+                                           uint64_t rows_accepted,
+                                           uint64_t rows_rejected,
+                                           uint64_t transactions_sent,
+                                           void* user_data);
+
+/// Import a payout file (CSV or JSON) and send it in batched transactions
+/// Paid rows are recorded in "<path>.paid"; calling again skips them.
+/// @param sdk SDK handle
+/// @param path Payout file path
+/// @param max_tx_size Size cap per transaction in bytes (0 = one transaction per batch)
+/// @param dry_run Nonzero to validate and total the file without sending
+/// @param progress Progress callback (may be NULL)
+/// @param user_data Passed to progress
+/// @param rows_accepted_out Payouts accepted (may be NULL)
+/// @param rows_rejected_out Payouts rejected (may be NULL)
+/// @param tx_count_out Transactions sent (may be NULL)
+/// @return 0 on success, error code otherwise (counts are still written,
+///         as of the last progress report)
+int intcoin_sdk_import_payouts(intcoin_sdk_t sdk,
+                               const char* path,
+                               size_t max_tx_size,
+                               int dry_run,
+                               intcoin_payout_progress_cb progress,
+                               void* user_data,
+                               uint64_t* rows_accepted_out,
+                               uint64_t* rows_rejected_out,
+                               size_t* tx_count_out);
+
 /// Start sync
 /// @param sdk SDK handle
 /// @return 0 on success, error code otherwise
@@ -381,22 +818,74 @@ void intcoin_sdk_stop_sync(intcoin_sdk_t sdk);
 /// @return Sync progress
 double intcoin_sdk_get_sync_progress(intcoin_sdk_t sdk);
 
+/// Get RPC call metrics in the Prometheus text format
+/// @param sdk SDK handle
+/// @param out Output buffer (may be NULL when out_size is 0)
+/// @param out_size Size of out; the text is truncated and NUL-terminated to fit
+/// @return Length of the full text, excluding the NUL (call again with a
+///         larger buffer if this is not less than out_size)
+size_t intcoin_sdk_get_metrics_prometheus(intcoin_sdk_t sdk, char* out, size_t out_size);
+
+/// Get memory held by the SDK as JSON, per subsystem
+/// e.g. {"total_bytes":N,"utxo_set":{"bytes":N,"peak_bytes":N,"blocks":N},...}
+/// @param sdk SDK handle
+/// @param out Output buffer (may be NULL when out_size is 0)
+/// @param out_size Size of out; the text is truncated and NUL-terminated to fit
+/// @return Length of the full text, excluding the NUL
+size_t intcoin_sdk_get_memory_usage(intcoin_sdk_t sdk, char* out, size_t out_size);
+
+/// Start recording sync and send trace spans (clears earlier events)
+/// Tracing is process-wide, covering every SDK instance.
+/// @param max_events Newest events kept
+void intcoin_sdk_trace_start(size_t max_events);
+
+/// Stop recording trace spans (recorded events are kept)
+void intcoin_sdk_trace_stop(void);
+
+/// Get recorded spans in the Chrome trace-event JSON format
+/// (loads in chrome://tracing and Perfetto)
+/// @param out Output buffer (may be NULL when out_size is 0)
+/// @param out_size Size of out; the text is truncated and NUL-terminated to fit
+/// @return Length of the full text, excluding the NUL
+size_t intcoin_sdk_trace_dump(char* out, size_t out_size);
+
+/// Write recorded spans to a Chrome trace-event JSON file
+/// @param path File path
+/// @return 0 on success, -1 on error
+int intcoin_sdk_trace_write(const char* path);
+
 /// Format INTS to human-readable string
 /// @param ints Amount in INTS
 /// @param out Output buffer (min 32 bytes)
 void intcoin_sdk_format_ints(uint64_t ints, char* out);
 
+/// Format a page of signed amounts (e.g. transaction history) in one call
+/// @param amounts Amounts in INTS
+/// @param count Number of amounts
+/// @param out Output buffer of count * 32 bytes; amount i is written
+///            NUL-terminated at out + i * 32
+/// @return Number of amounts formatted
+size_t intcoin_sdk_format_ints_batch(const int64_t* amounts, size_t count, char* out);
+
 /// Validate address
 /// @param address Address to validate
 /// @return 1 if valid, 0 otherwise
 int intcoin_sdk_validate_address(const char* address);
 
+/// Validate many addresses (e.g. a payout file) in one call
+/// @param addresses Addresses to validate
+/// @param count Number of addresses
+/// @param errors_out Per-address result (count entries): 0 if valid,
+///                   otherwise an intcoin::mobile::AddressError code
+/// @return Number of valid addresses
+size_t intcoin_sdk_validate_addresses(const char* const* addresses, size_t count, uint8_t* errors_out);
+
 /// Generate payment URI
 /// @param address Receiving address
 /// @param amount_ints Amount (0 for no amount)
 /// @param label Label (NULL for none)
 /// @param message Message (NULL for none)
-/// @param uri_out Output buffer (min 512 bytes)
+/// @param uri_out Output buffer (512 bytes; left empty if the URI does not fit)
 void intcoin_sdk_generate_payment_uri(const char* address,
                                        uint64_t amount_ints,
                                        const char* label,
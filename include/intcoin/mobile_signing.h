@@ -0,0 +1,91 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_SIGNING_H
+#define INTCOIN_MOBILE_SIGNING_H
+
+#include <intcoin/transaction.h>
+#include <intcoin/types.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// Fixed-size worker pool for CPU-bound batch jobs
+/// The calling thread takes part in every job, so a pool of N threads
+/// runs N + 1 lanes. Jobs are run one at a time.
+class WorkerPool {
+public:
+    /// Create pool
+    /// @param threads Worker threads besides the caller (0 = run on caller only)
+    explicit WorkerPool(size_t threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Lanes available to a job (workers plus caller)
+    size_t GetLaneCount() const { return workers_.size() + 1; }
+
+    /// Run fn(i) for every i in [0, count) and wait for all to finish
+    /// @param count Number of items
+    /// @param fn Item function, called concurrently from several threads
+    void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+private:
+    std::vector<std::thread> workers_;
+
+    /// Serializes ParallelFor callers
+    std::mutex run_mutex_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    // Current job, published under mutex_
+    const std::function<void(size_t)>* job_ = nullptr;
+    size_t job_count_ = 0;
+    std::atomic<size_t> next_item_{0};
+    uint64_t generation_ = 0;
+    size_t finished_workers_ = 0;
+    bool stop_ = false;
+
+    void WorkerLoop();
+
+    /// Claim and run items of the current job until none are left
+    void Drain();
+};
+
+/// Whole-transaction signing callback (normally the wallet's signer,
+/// which owns the signature hash and key lookup)
+/// The SDK never computes a signature hash itself, so reuse of the parts
+/// shared by a transaction's inputs is up to the signer. Must be safe to
+/// call concurrently for different transactions when given a pool.
+/// @param tx Unsigned transaction
+/// @return Signed transaction
+using TransactionSignFn = std::function<Result<Transaction>(const Transaction& tx)>;
+
+/// Sign a batch of transactions
+/// Transactions are spread over the pool and each result lands in its
+/// slot, so the output does not depend on thread count or scheduling. On
+/// failure the error of the lowest failing transaction is returned.
+/// @param txs Unsigned transactions
+/// @param sign Signing callback
+/// @param pool Worker pool (nullptr = sign on caller thread)
+/// @return Signed transactions, in input order
+Result<std::vector<Transaction>> SignTransactions(const std::vector<Transaction>& txs,
+                                                  const TransactionSignFn& sign,
+                                                  WorkerPool* pool);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_SIGNING_H
@@ -0,0 +1,126 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_TRACE_H
+#define INTCOIN_MOBILE_TRACE_H
+
+#include <intcoin/types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// One completed span
+/// Names are not copied, so they must be string literals.
+struct TraceEvent {
+    const char* category = nullptr;
+    const char* name = nullptr;
+    uint64_t start_ns = 0;     // Since tracing started
+    uint64_t duration_ns = 0;
+    uint32_t thread_id = 0;    // Small per-thread number, in order of first span
+    const char* arg_name = nullptr;  // Optional numeric argument
+    int64_t arg_value = 0;
+};
+
+/// Process-wide ring buffer of trace spans
+/// While stopped, a span costs one relaxed atomic load. While running,
+/// the newest events are kept and older ones overwritten, so a long
+/// session still ends with its most recent history.
+class TraceBuffer {
+public:
+    static TraceBuffer& Global();
+
+    /// Clear the buffer and start recording
+    /// @param max_events Ring buffer capacity
+    void Start(size_t max_events);
+
+    /// Start recording unless already recording
+    /// Lets several users turn tracing on without clearing each other's events.
+    /// @param max_events Ring buffer capacity (used only if this call starts it)
+    /// @return True if this call started recording
+    bool StartIfStopped(size_t max_events);
+
+    /// Stop recording (recorded events are kept for dumping)
+    void Stop();
+
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    void Add(const TraceEvent& event);
+
+    /// Recorded events, oldest first
+    std::vector<TraceEvent> GetEvents() const;
+
+    /// Events overwritten since Start
+    uint64_t GetDroppedCount() const;
+
+    /// Render events in the Chrome trace-event JSON format
+    /// (loads in chrome://tracing and Perfetto)
+    std::string DumpChromeTrace() const;
+
+    /// Write DumpChromeTrace() to a file
+    Result<void> WriteChromeTrace(const std::string& path) const;
+
+    /// Nanoseconds since tracing started
+    uint64_t NowNs() const;
+
+private:
+    static std::atomic<bool> enabled_;
+
+    mutable std::mutex mutex_;
+    std::vector<TraceEvent> events_;
+    size_t next_ = 0;        // Slot the next event goes to
+    uint64_t written_ = 0;   // Events added since Start
+    std::atomic<int64_t> epoch_ns_{0};  // steady_clock at Start
+};
+
+/// Number for the calling thread in trace output
+uint32_t TraceThreadId();
+
+/// Records the time between construction and destruction as one event
+/// Usage: TraceSpan span("send", "sign_transactions");
+class TraceSpan {
+public:
+    /// @param category Pipeline the span belongs to (string literal)
+    /// @param name Stage name (string literal)
+    TraceSpan(const char* category, const char* name)
+        : active_(TraceBuffer::IsEnabled()) {
+        if (active_) {
+            event_.category = category;
+            event_.name = name;
+            event_.start_ns = TraceBuffer::Global().NowNs();
+        }
+    }
+
+    ~TraceSpan() {
+        if (active_) {
+            End();
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    /// Attach a number to the span (e.g. inputs signed)
+    /// @param name Argument name (string literal)
+    void SetArg(const char* name, int64_t value) {
+        event_.arg_name = name;
+        event_.arg_value = value;
+    }
+
+private:
+    bool active_;
+    TraceEvent event_;
+
+    void End();
+};
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_TRACE_H
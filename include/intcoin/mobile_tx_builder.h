@@ -0,0 +1,88 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_TX_BUILDER_H
+#define INTCOIN_MOBILE_TX_BUILDER_H
+
+#include <intcoin/mobile_address_validation.h>
+#include <intcoin/script.h>
+#include <intcoin/transaction.h>
+#include <intcoin/types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+// Serialized sizes used for fee estimation. A Dilithium5 input carries a
+// 4595-byte signature and a 2592-byte public key, so inputs dominate the
+// size of every transaction the SDK builds.
+
+/// Input: outpoint (36) + signature (3 + 4595) + public key (3 + 2592) + sequence (4)
+constexpr size_t TX_INPUT_SIZE = 7233;
+
+/// P2PKH script: five opcodes around the address payload
+constexpr size_t P2PKH_SCRIPT_SIZE = 5 + ADDRESS_PROGRAM_SIZE;
+
+/// Output: value (8) + script length (1) + P2PKH script (25)
+constexpr size_t TX_OUTPUT_SIZE = 9 + P2PKH_SCRIPT_SIZE;
+
+/// Version (4) + input/output counts (2 x up to 3) + locktime (4)
+constexpr size_t TX_OVERHEAD_SIZE = 14;
+
+/// Minimum relay fee in INTS (matches MobileRPC::EstimateFee)
+constexpr uint64_t MIN_TX_FEE = 1000;
+
+/// Estimate serialized transaction size
+/// @param num_inputs Number of inputs
+/// @param num_outputs Number of outputs
+/// @return Size in bytes
+inline size_t EstimateTransactionSize(size_t num_inputs, size_t num_outputs) {
+    return TX_OVERHEAD_SIZE + num_inputs * TX_INPUT_SIZE + num_outputs * TX_OUTPUT_SIZE;
+}
+
+/// Fee for a transaction of the given size
+/// @param tx_size Size in bytes
+/// @param fee_rate Fee rate in INTS per KB
+/// @return Fee in INTS (at least MIN_TX_FEE)
+inline uint64_t FeeForSize(size_t tx_size, uint64_t fee_rate) {
+    return std::max<uint64_t>((tx_size * fee_rate) / 1000, MIN_TX_FEE);
+}
+
+/// Payment recipient
+struct TxRecipient {
+    std::string address;
+    uint64_t amount_ints;
+};
+
+/// Spendable output chosen as a transaction input
+struct TxInputCoin {
+    uint256 tx_hash;
+    uint32_t output_index;
+    uint64_t amount;
+};
+
+/// Build the P2PKH output script paying to an address's decoded payload
+/// @param address Recipient address
+/// @return Output script
+Result<Script> ScriptForAddress(const std::string& address);
+
+/// Build unsigned transaction
+/// @param inputs Coins to spend
+/// @param recipients Payment outputs
+/// @param change_address Change address (ignored if change is 0)
+/// @param change Change amount in INTS
+/// @return Unsigned transaction
+Result<Transaction> BuildUnsignedTransaction(const std::vector<TxInputCoin>& inputs,
+                                             const std::vector<TxRecipient>& recipients,
+                                             const std::string& change_address,
+                                             uint64_t change);
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_TX_BUILDER_H
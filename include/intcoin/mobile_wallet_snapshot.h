@@ -0,0 +1,137 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_MOBILE_WALLET_SNAPSHOT_H
+#define INTCOIN_MOBILE_WALLET_SNAPSHOT_H
+
+#include <intcoin/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+/// Snapshot format version (bump on any record layout change)
+constexpr uint32_t WALLET_SNAPSHOT_VERSION = 1;
+
+// On-disk records are fixed-size and read in place from the mapping.
+// Integers are stored in host byte order; the header's endian tag rejects
+// snapshots written on a machine of the other byte order.
+#pragma pack(push, 1)
+
+/// Snapshot file header
+struct SnapshotHeader {
+    char magic[8];              // "INTWSNAP"
+    uint32_t version;           // WALLET_SNAPSHOT_VERSION
+    uint32_t endian_tag;        // 0x01020304 as written by the host
+    uint64_t tip_height;        // Chain tip the snapshot was taken at
+    uint8_t tip_hash[32];
+    uint64_t confirmed_balance;
+    uint64_t unconfirmed_balance;
+    uint64_t utxo_count;
+    uint64_t history_count;
+    uint64_t address_count;
+    uint64_t string_bytes;      // Size of the address string blob
+};
+
+/// Unspent output record
+struct SnapshotUTXO {
+    uint8_t tx_hash[32];
+    uint32_t output_index;
+    uint64_t amount;
+    uint64_t block_height;
+};
+
+/// Transaction history record
+struct SnapshotHistoryEntry {
+    uint8_t tx_hash[32];
+    uint64_t amount;
+    uint64_t block_height;
+    uint64_t timestamp;
+    uint8_t is_incoming;
+};
+
+/// Address record (string lives in the blob after the records)
+struct SnapshotAddress {
+    uint32_t offset;
+    uint32_t length;
+    uint8_t is_change;
+};
+
+#pragma pack(pop)
+
+/// Derived wallet state to be written to a snapshot
+struct WalletSnapshotData {
+    uint64_t tip_height = 0;
+    uint256 tip_hash{};
+    uint64_t confirmed_balance = 0;
+    uint64_t unconfirmed_balance = 0;
+    std::vector<SnapshotUTXO> utxos;
+    std::vector<SnapshotHistoryEntry> history;
+    std::vector<std::pair<std::string, bool>> addresses;  // (address, is_change)
+};
+
+/// Read-only, memory-mapped wallet snapshot
+/// Opening costs one mmap and a header check, independent of history size
+class WalletSnapshot {
+public:
+    ~WalletSnapshot();
+
+    WalletSnapshot(const WalletSnapshot&) = delete;
+    WalletSnapshot& operator=(const WalletSnapshot&) = delete;
+
+    /// Map snapshot file and validate its header and size
+    /// @param path Snapshot file path
+    /// @return Mapped snapshot
+    static Result<std::shared_ptr<WalletSnapshot>> Open(const std::string& path);
+
+    /// Write snapshot atomically (temp file, fsync, rename)
+    /// @param path Snapshot file path
+    /// @param data Derived wallet state
+    /// @return Success/failure result
+    static Result<void> Write(const std::string& path, const WalletSnapshotData& data);
+
+    /// Chain tip the snapshot was taken at
+    uint64_t GetTipHeight() const { return header_->tip_height; }
+    uint256 GetTipHash() const;
+
+    uint64_t GetConfirmedBalance() const { return header_->confirmed_balance; }
+    uint64_t GetUnconfirmedBalance() const { return header_->unconfirmed_balance; }
+
+    /// Record arrays (valid for the lifetime of the snapshot)
+    size_t GetUTXOCount() const { return header_->utxo_count; }
+    const SnapshotUTXO* GetUTXOs() const { return utxos_; }
+
+    size_t GetHistoryCount() const { return header_->history_count; }
+    const SnapshotHistoryEntry* GetHistory() const { return history_; }
+
+    size_t GetAddressCount() const { return header_->address_count; }
+    std::string_view GetAddress(size_t index) const;
+    bool IsChangeAddress(size_t index) const { return addresses_[index].is_change != 0; }
+
+    /// Size of the mapping in bytes
+    size_t GetMappedSize() const { return size_; }
+
+private:
+    WalletSnapshot() = default;
+
+    void* mapping_ = nullptr;
+    size_t size_ = 0;
+
+    const SnapshotHeader* header_ = nullptr;
+    const SnapshotUTXO* utxos_ = nullptr;
+    const SnapshotHistoryEntry* history_ = nullptr;
+    const SnapshotAddress* addresses_ = nullptr;
+    const char* strings_ = nullptr;
+};
+
+}  // namespace mobile
+}  // namespace intcoin
+
+#endif  // INTCOIN_MOBILE_WALLET_SNAPSHOT_H
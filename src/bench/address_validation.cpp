@@ -0,0 +1,188 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Address validation throughput: validates a payout-sized list of
+// addresses (a few percent corrupted, upper case or too short) one at a
+// time and in a batch, against the substr prefix check plus generic
+// Bech32 decode that ValidateAddress used before.
+
+#include "bench.h"
+
+#include <intcoin/mobile_address_validation.h>
+
+#include <cctype>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+constexpr size_t ADDRESS_COUNT = 500000;
+
+/// One address in this many is corrupted
+constexpr size_t CORRUPT_EVERY = 25;
+
+constexpr char CHARSET[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+uint32_t Polymod(const std::vector<uint8_t>& values) {
+    static const uint32_t GEN[5] = {0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3};
+    uint32_t chk = 1;
+    for (uint8_t value : values) {
+        uint32_t top = chk >> 25;
+        chk = ((chk & 0x1ffffff) << 5) ^ value;
+        for (int i = 0; i < 5; ++i) {
+            if ((top >> i) & 1) {
+                chk ^= GEN[i];
+            }
+        }
+    }
+    return chk;
+}
+
+std::vector<uint8_t> ExpandHrp(const std::string& hrp) {
+    std::vector<uint8_t> out;
+    for (char c : hrp) out.push_back(static_cast<uint8_t>(c) >> 5);
+    out.push_back(0);
+    for (char c : hrp) out.push_back(static_cast<uint8_t>(c) & 31);
+    return out;
+}
+
+std::string Encode(const std::string& hrp, const std::vector<uint8_t>& bytes) {
+    std::vector<uint8_t> data;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (uint8_t byte : bytes) {
+        acc = (acc << 8) | byte;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            data.push_back((acc >> bits) & 31);
+        }
+    }
+    if (bits > 0) {
+        data.push_back((acc << (5 - bits)) & 31);
+    }
+
+    std::vector<uint8_t> values = ExpandHrp(hrp);
+    values.insert(values.end(), data.begin(), data.end());
+    values.insert(values.end(), 6, 0);
+    uint32_t mod = Polymod(values) ^ 1;
+
+    std::string out = hrp + "1";
+    for (uint8_t d : data) out += CHARSET[d];
+    for (int i = 0; i < 6; ++i) out += CHARSET[(mod >> (5 * (5 - i))) & 31];
+    return out;
+}
+
+/// Generic decoder in the shape of the one the SDK called per address
+bool LegacyDecode(const std::string& str, std::string* hrp, std::vector<uint8_t>* data) {
+    bool lower = false, upper = false;
+    for (char c : str) {
+        if (c >= 'a' && c <= 'z') lower = true;
+        else if (c >= 'A' && c <= 'Z') upper = true;
+        else if (c < 33 || c > 126) return false;
+    }
+    if (lower && upper) return false;
+    size_t pos = str.rfind('1');
+    if (pos == std::string::npos || pos == 0 || pos + 7 > str.size() || str.size() > 90) {
+        return false;
+    }
+
+    std::string lowered;
+    for (char c : str) lowered += (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    *hrp = lowered.substr(0, pos);
+
+    std::vector<uint8_t> values;
+    for (size_t i = pos + 1; i < lowered.size(); ++i) {
+        const char* found = std::char_traits<char>::find(CHARSET, 32, lowered[i]);
+        if (!found) return false;
+        values.push_back(static_cast<uint8_t>(found - CHARSET));
+    }
+    std::vector<uint8_t> check = ExpandHrp(*hrp);
+    check.insert(check.end(), values.begin(), values.end());
+    if (Polymod(check) != 1) return false;
+
+    // Five-bit groups, checksum dropped
+    data->assign(values.begin(), values.end() - 6);
+    return true;
+}
+
+bool LegacyValidate(const std::string& address) {
+    if (address.substr(0, 4) != "int1" && address.substr(0, 5) != "tint1") {
+        return false;
+    }
+    std::string hrp;
+    std::vector<uint8_t> data;
+    return LegacyDecode(address, &hrp, &data) && data.size() >= 32;
+}
+
+std::vector<std::string> MakeAddresses() {
+    std::mt19937_64 rng(40);
+    std::vector<std::string> addresses(ADDRESS_COUNT);
+    for (size_t i = 0; i < ADDRESS_COUNT; ++i) {
+        // Mostly 32-byte hashes; a few 20 (32 characters, the minimum) and
+        // 16 (too short)
+        std::vector<uint8_t> hash(i % 50 == 7 ? 20 : i % 50 == 9 ? 16 : 32);
+        for (auto& byte : hash) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        addresses[i] = Encode(i % 10 == 0 ? "tint" : "int", hash);
+        if (i % CORRUPT_EVERY == 0) {
+            // Flip one data character to another valid one
+            size_t pos = addresses[i].size() - 1 - rng() % 25;
+            addresses[i][pos] = addresses[i][pos] == 'q' ? 'p' : 'q';
+        } else if (i % CORRUPT_EVERY == 11) {
+            // Upper case, which the prefix check has never accepted
+            for (auto& c : addresses[i]) {
+                c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            }
+        }
+    }
+    return addresses;
+}
+
+void ReportRun(const char* impl, uint64_t elapsed_ns, size_t valid) {
+    bench::Report("address_validation")
+        .Add("impl", impl)
+        .Add("addresses", static_cast<uint64_t>(ADDRESS_COUNT))
+        .Add("valid", static_cast<uint64_t>(valid))
+        .Add("addresses_per_sec", ADDRESS_COUNT * 1e9 / static_cast<double>(elapsed_ns))
+        .Print();
+}
+
+}  // namespace
+
+int main() {
+    const std::vector<std::string> addresses = MakeAddresses();
+    std::vector<std::string_view> views(addresses.begin(), addresses.end());
+
+    size_t legacy_valid = 0;
+    auto start = bench::Clock::now();
+    for (const auto& address : addresses) {
+        legacy_valid += LegacyValidate(address) ? 1 : 0;
+    }
+    ReportRun("generic_decode", bench::ElapsedNs(start), legacy_valid);
+
+    size_t scalar_valid = 0;
+    start = bench::Clock::now();
+    for (std::string_view address : views) {
+        scalar_valid += ValidateAddressFast(address) == AddressError::OK ? 1 : 0;
+    }
+    ReportRun("scalar", bench::ElapsedNs(start), scalar_valid);
+
+    std::vector<AddressError> errors(ADDRESS_COUNT);
+    start = bench::Clock::now();
+    size_t batch_valid = ValidateAddresses(views.data(), views.size(), errors.data());
+    ReportRun("batch", bench::ElapsedNs(start), batch_valid);
+
+    if (scalar_valid != legacy_valid || batch_valid != legacy_valid) {
+        std::fprintf(stderr, "validators disagree: legacy %zu, scalar %zu, batch %zu\n",
+                     legacy_valid, scalar_valid, batch_valid);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Amount formatting and parsing throughput: formats a million history
+// amounts one at a time and a page at a time, and parses them back,
+// against the ostringstream/stoull code the kernels replaced.
+
+#include "bench.h"
+
+#include <intcoin/mobile_amount.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+constexpr size_t AMOUNT_COUNT = 1000000;
+
+/// Rows a history list formats per page
+constexpr size_t PAGE_SIZE = 50;
+
+constexpr size_t SLOT_SIZE = 32;
+
+std::vector<int64_t> MakeAmounts() {
+    // Mostly small payments, some large, both directions
+    std::mt19937_64 rng(11);
+    std::lognormal_distribution<double> dist(std::log(5e6), 2.0);
+    std::vector<int64_t> amounts(AMOUNT_COUNT);
+    for (auto& amount : amounts) {
+        amount = static_cast<int64_t>(std::min(dist(rng), 1e15));
+        if (rng() % 3 == 0) {
+            amount = -amount;
+        }
+    }
+    return amounts;
+}
+
+std::string LegacyFormat(uint64_t ints) {
+    std::ostringstream ss;
+    ss << ints / 1000000 << "." << std::setfill('0') << std::setw(6) << ints % 1000000 << " INT";
+    return ss.str();
+}
+
+uint64_t LegacyParse(const std::string& amount_str) {
+    size_t dot_pos = amount_str.find('.');
+    std::string int_part = amount_str.substr(0, dot_pos);
+    std::string frac_part = amount_str.substr(dot_pos + 1);
+    while (frac_part.length() < 6) {
+        frac_part += "0";
+    }
+    if (frac_part.length() > 6) {
+        frac_part = frac_part.substr(0, 6);
+    }
+    return std::stoull(int_part) * 1000000 + std::stoull(frac_part);
+}
+
+void ReportRun(const char* op, const char* impl, uint64_t elapsed_ns) {
+    bench::Report("amount")
+        .Add("op", op)
+        .Add("impl", impl)
+        .Add("amounts", static_cast<uint64_t>(AMOUNT_COUNT))
+        .Add("ns_per_amount", static_cast<double>(elapsed_ns) / AMOUNT_COUNT)
+        .Print();
+}
+
+}  // namespace
+
+int main() {
+    const std::vector<int64_t> amounts = MakeAmounts();
+    std::vector<uint64_t> magnitudes(AMOUNT_COUNT);
+    for (size_t i = 0; i < AMOUNT_COUNT; ++i) {
+        magnitudes[i] = static_cast<uint64_t>(amounts[i] < 0 ? -amounts[i] : amounts[i]);
+    }
+
+    AmountFormat format;
+    format.unit_suffix = true;
+
+    volatile size_t sink = 0;
+
+    auto start = bench::Clock::now();
+    for (uint64_t ints : magnitudes) {
+        sink = sink + LegacyFormat(ints).size();
+    }
+    ReportRun("format", "ostringstream", bench::ElapsedNs(start));
+
+    char buf[MAX_AMOUNT_CHARS];
+    start = bench::Clock::now();
+    for (int64_t ints : amounts) {
+        sink = sink + static_cast<size_t>(SignedAmountToChars(buf, buf + sizeof(buf), ints, format).ptr - buf);
+    }
+    ReportRun("format", "to_chars", bench::ElapsedNs(start));
+
+    std::vector<char> page(PAGE_SIZE * SLOT_SIZE);
+    start = bench::Clock::now();
+    for (size_t i = 0; i < AMOUNT_COUNT; i += PAGE_SIZE) {
+        sink = sink + FormatSignedAmounts(&amounts[i], std::min(PAGE_SIZE, AMOUNT_COUNT - i),
+                                          page.data(), SLOT_SIZE, format);
+    }
+    ReportRun("format", "batch_page", bench::ElapsedNs(start));
+
+    // Parse the decimal form back
+    std::vector<std::string> texts(AMOUNT_COUNT);
+    AmountFormat plain;
+    for (size_t i = 0; i < AMOUNT_COUNT; ++i) {
+        char* end = AmountToChars(buf, buf + sizeof(buf), magnitudes[i], plain).ptr;
+        texts[i].assign(buf, end);
+    }
+
+    start = bench::Clock::now();
+    for (const auto& text : texts) {
+        sink = sink + LegacyParse(text);
+    }
+    ReportRun("parse", "stoull", bench::ElapsedNs(start));
+
+    size_t mismatches = 0;
+    start = bench::Clock::now();
+    for (size_t i = 0; i < AMOUNT_COUNT; ++i) {
+        uint64_t ints = 0;
+        const std::string& text = texts[i];
+        auto result = AmountFromChars(text.data(), text.data() + text.size(), ints);
+        if (result.ec != std::errc() || ints != magnitudes[i]) {
+            ++mismatches;
+        }
+    }
+    ReportRun("parse", "from_chars", bench::ElapsedNs(start));
+
+    if (mismatches > 0) {
+        std::fprintf(stderr, "%zu amounts did not round-trip\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
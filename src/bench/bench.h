@@ -0,0 +1,86 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_BENCH_BENCH_H
+#define INTCOIN_BENCH_BENCH_H
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace intcoin {
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+/// Nanoseconds elapsed since start
+inline uint64_t ElapsedNs(Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+/// Call fn until at least min_ns have passed (and at least once)
+/// @param calls_out Set to the number of calls made (may be null)
+/// @return Mean nanoseconds per call
+template <typename Fn>
+double TimePerCall(Fn&& fn, uint64_t min_ns = 200000000, uint64_t* calls_out = nullptr) {
+    uint64_t calls = 0;
+    auto start = Clock::now();
+    uint64_t elapsed = 0;
+    do {
+        fn();
+        ++calls;
+        elapsed = ElapsedNs(start);
+    } while (elapsed < min_ns);
+    if (calls_out) {
+        *calls_out = calls;
+    }
+    return static_cast<double>(elapsed) / static_cast<double>(calls);
+}
+
+/// One benchmark result, printed as a single JSON object per line so runs
+/// can be collected and compared between SDK releases
+class Report {
+public:
+    explicit Report(const std::string& name) {
+        body_ = "{\"bench\":\"" + name + "\"";
+    }
+
+    Report& Add(const char* key, const std::string& value) {
+        body_ += ",\"" + std::string(key) + "\":\"" + value + "\"";
+        return *this;
+    }
+
+    Report& Add(const char* key, const char* value) {
+        return Add(key, std::string(value));
+    }
+
+    Report& Add(const char* key, uint64_t value) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%" PRIu64, value);
+        body_ += ",\"" + std::string(key) + "\":" + buf;
+        return *this;
+    }
+
+    Report& Add(const char* key, double value) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.3f", value);
+        body_ += ",\"" + std::string(key) + "\":" + buf;
+        return *this;
+    }
+
+    void Print() const {
+        std::printf("%s}\n", body_.c_str());
+        std::fflush(stdout);
+    }
+
+private:
+    std::string body_;
+};
+
+}  // namespace bench
+}  // namespace intcoin
+
+#endif  // INTCOIN_BENCH_BENCH_H
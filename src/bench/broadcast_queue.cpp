@@ -0,0 +1,156 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Broadcast queue behaviour over LoopbackTransport peers: queues a burst
+// of transactions against healthy, flaky, briefly offline and absent
+// peers, and reports time to first relay and to acknowledgement, the
+// attempts spent, and whether every transaction was accepted.
+
+#include "bench.h"
+
+#include <intcoin/mobile_broadcast_queue.h>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+constexpr size_t TX_COUNT = 50;
+
+/// Smallest transaction RawTransactionView accepts, made unique by its outpoint
+std::vector<uint8_t> MakeRawTransaction(uint32_t id) {
+    std::vector<uint8_t> raw;
+    auto put_le = [&raw](uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            raw.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    };
+
+    put_le(1, 4);                     // Version
+    raw.push_back(1);                 // Inputs
+    put_le(id, 4);                    // Prev hash
+    raw.insert(raw.end(), 28, 0);
+    put_le(0, 4);                     // Prev index
+    raw.push_back(0);                 // Signature
+    raw.push_back(0);                 // Public key
+    put_le(0xFFFFFFFF, 4);            // Sequence
+    raw.push_back(1);                 // Outputs
+    put_le(100000, 8);                // Value
+    raw.push_back(1);                 // Script
+    raw.push_back(0x51);
+    put_le(0, 4);                     // Locktime
+    return raw;
+}
+
+struct Scenario {
+    const char* name;
+    std::vector<LoopbackTransport::Peer> peers;
+    std::chrono::milliseconds offline_for{0};  // All peers down this long after the burst
+};
+
+bool WaitForDrain(const BroadcastQueue& queue, std::chrono::seconds limit) {
+    auto deadline = bench::Clock::now() + limit;
+    while (queue.GetPendingCount() > 0) {
+        if (bench::Clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+void Run(const Scenario& scenario) {
+    auto transport = std::make_shared<LoopbackTransport>(scenario.peers, 7);
+
+    BroadcastQueueConfig config;
+    config.fanout = 3;
+    config.attempt_timeout = std::chrono::milliseconds(1000);
+    config.initial_backoff = std::chrono::milliseconds(20);
+    config.max_backoff = std::chrono::milliseconds(200);
+
+    BroadcastQueue queue(config, transport);
+    queue.Start();
+
+    if (scenario.offline_for.count() > 0) {
+        for (size_t i = 0; i < scenario.peers.size(); ++i) {
+            transport->SetPeerOnline(i, false);
+        }
+    }
+
+    auto start = bench::Clock::now();
+    for (uint32_t i = 0; i < TX_COUNT; ++i) {
+        auto result = queue.Enqueue(MakeRawTransaction(i + 1));
+        if (result.IsError()) {
+            std::fprintf(stderr, "enqueue failed: %s\n", result.error.c_str());
+            return;
+        }
+    }
+
+    if (scenario.offline_for.count() > 0) {
+        std::this_thread::sleep_for(scenario.offline_for);
+        for (size_t i = 0; i < scenario.peers.size(); ++i) {
+            transport->SetPeerOnline(i, true);
+        }
+        queue.RetryNow();
+    }
+
+    // Without peers nothing can drain; give the worker time to misbehave
+    bool drained = false;
+    if (scenario.peers.empty()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    } else {
+        drained = WaitForDrain(queue, std::chrono::seconds(30));
+    }
+    uint64_t elapsed = bench::ElapsedNs(start);
+
+    BroadcastMetrics metrics = queue.GetMetrics();
+    queue.Stop();
+
+    bench::Report("broadcast_queue")
+        .Add("scenario", scenario.name)
+        .Add("peers", static_cast<uint64_t>(scenario.peers.size()))
+        .Add("transactions", static_cast<uint64_t>(TX_COUNT))
+        .Add("wall_ms", elapsed / 1e6)
+        .Add("avg_first_relay_ms", metrics.avg_first_relay_ms)
+        .Add("avg_ack_ms", metrics.avg_ack_ms)
+        .Add("max_ack_ms", metrics.max_ack_ms)
+        .Add("attempts", metrics.attempts)
+        .Add("failed_attempts", metrics.failed_attempts)
+        .Add("acknowledged", metrics.acknowledged)
+        .Add("accepted_relays", transport->GetAcceptedCount())
+        .Add("pending", static_cast<uint64_t>(metrics.pending))
+        .Add("drained", drained ? "yes" : "no")
+        .Print();
+}
+
+}  // namespace
+
+int main() {
+    LoopbackTransport::Peer healthy;
+    healthy.latency = std::chrono::milliseconds(5);
+
+    LoopbackTransport::Peer flaky = healthy;
+    flaky.failure_rate = 0.6;
+
+    LoopbackTransport::Peer slow;
+    slow.latency = std::chrono::milliseconds(40);
+
+    const Scenario scenarios[] = {
+        {"healthy", {healthy, healthy, healthy}},
+        {"flaky", {flaky, flaky, flaky}},
+        {"one_fast_two_slow", {healthy, slow, slow}},
+        {"offline_then_back", {healthy, healthy, healthy}, std::chrono::milliseconds(300)},
+        // No attempts or first relays may be recorded
+        {"no_peers", {}},
+    };
+
+    for (const auto& scenario : scenarios) {
+        Run(scenario);
+    }
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Coin selection simulation: replays payment workloads against each
+// strategy and reports total fees paid and UTXO set growth.
+
+#include "bench.h"
+
+#include <intcoin/mobile_coin_selection.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+struct Workload {
+    const char* name;
+    size_t steps;
+    double deposit_probability;  // Chance a step is an incoming payment
+    double deposit_mean_int;     // Mean incoming amount in INT (log-normal)
+    double payment_mean_int;     // Mean outgoing amount in INT (log-normal)
+};
+
+constexpr Workload WORKLOADS[] = {
+    {"retail", 5000, 0.5, 20.0, 5.0},         // Frequent small receipts and payments
+    {"merchant", 5000, 0.8, 2.0, 8.0},        // Many small receipts, few larger payments
+    {"payout", 5000, 0.1, 5000.0, 10.0},      // Few large deposits, many small payouts
+};
+
+constexpr CoinSelectionStrategy STRATEGIES[] = {
+    CoinSelectionStrategy::AUTO,
+    CoinSelectionStrategy::KNAPSACK,
+    CoinSelectionStrategy::LARGEST_FIRST,
+};
+
+constexpr uint64_t FEE_RATE = 2000;  // INTS per KB
+constexpr size_t INITIAL_UTXOS = 50;
+
+uint64_t DrawAmount(std::mt19937_64& rng, double mean_int) {
+    std::lognormal_distribution<double> dist(std::log(mean_int), 1.0);
+    return std::max<uint64_t>(1000, static_cast<uint64_t>(dist(rng) * 1000000.0));
+}
+
+TxInputCoin NewCoin(uint64_t& next_id, uint64_t amount) {
+    TxInputCoin coin{};
+    uint64_t id = next_id++;
+    std::memcpy(coin.tx_hash.data(), &id, sizeof(id));
+    coin.output_index = 0;
+    coin.amount = amount;
+    return coin;
+}
+
+uint64_t CoinId(const TxInputCoin& coin) {
+    uint64_t id;
+    std::memcpy(&id, coin.tx_hash.data(), sizeof(id));
+    return id;
+}
+
+void Simulate(const Workload& workload, CoinSelectionStrategy strategy) {
+    // Same seed per workload so every strategy sees identical payments
+    std::mt19937_64 rng(0x1c0de + workload.steps);
+    std::bernoulli_distribution is_deposit(workload.deposit_probability);
+
+    uint64_t next_id = 0;
+    std::vector<TxInputCoin> pool;
+    for (size_t i = 0; i < INITIAL_UTXOS; ++i) {
+        pool.push_back(NewCoin(next_id, DrawAmount(rng, workload.deposit_mean_int)));
+    }
+
+    uint64_t total_fees = 0;
+    uint64_t total_size = 0;
+    uint64_t total_inputs = 0;
+    uint64_t payments = 0;
+    uint64_t failures = 0;
+    uint64_t select_ns = 0;
+    uint64_t max_select_ns = 0;
+    size_t peak_utxos = pool.size();
+
+    for (size_t step = 0; step < workload.steps; ++step) {
+        if (is_deposit(rng)) {
+            pool.push_back(NewCoin(next_id, DrawAmount(rng, workload.deposit_mean_int)));
+            peak_utxos = std::max(peak_utxos, pool.size());
+            continue;
+        }
+
+        CoinSelectionParams params;
+        params.target = DrawAmount(rng, workload.payment_mean_int);
+        params.fee_rate = FEE_RATE;
+        params.num_outputs = 1;
+        params.strategy = strategy;
+
+        auto start = bench::Clock::now();
+        SortedUTXOIndex index(pool);
+        auto result = SelectCoins(index, params);
+        uint64_t elapsed = bench::ElapsedNs(start);
+        select_ns += elapsed;
+        max_select_ns = std::max(max_select_ns, elapsed);
+
+        if (result.IsError()) {
+            ++failures;
+            continue;
+        }
+
+        const auto& selection = result.GetValue();
+        std::unordered_set<uint64_t> spent;
+        for (const auto& coin : selection.coins) {
+            spent.insert(CoinId(coin));
+        }
+        pool.erase(std::remove_if(pool.begin(), pool.end(), [&](const TxInputCoin& coin) {
+            return spent.count(CoinId(coin)) > 0;
+        }), pool.end());
+        if (selection.change > 0) {
+            pool.push_back(NewCoin(next_id, selection.change));
+        }
+
+        ++payments;
+        total_fees += selection.fee;
+        total_size += selection.tx_size;
+        total_inputs += selection.coins.size();
+        peak_utxos = std::max(peak_utxos, pool.size());
+    }
+
+    uint64_t attempts = payments + failures;
+    bench::Report("coin_selection")
+        .Add("workload", workload.name)
+        .Add("strategy", CoinSelectionStrategyName(strategy))
+        .Add("payments", payments)
+        .Add("failures", failures)
+        .Add("total_fees_ints", total_fees)
+        .Add("avg_tx_size", payments ? static_cast<double>(total_size) / payments : 0.0)
+        .Add("avg_inputs", payments ? static_cast<double>(total_inputs) / payments : 0.0)
+        .Add("final_utxos", static_cast<uint64_t>(pool.size()))
+        .Add("peak_utxos", static_cast<uint64_t>(peak_utxos))
+        .Add("avg_select_us", attempts ? select_ns / 1000.0 / attempts : 0.0)
+        .Add("max_select_us", max_select_ns / 1000.0)
+        .Print();
+}
+
+}  // namespace
+
+int main() {
+    for (const auto& workload : WORKLOADS) {
+        for (auto strategy : STRATEGIES) {
+            Simulate(workload, strategy);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,325 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include "mock_core.h"
+
+#include <intcoin/spv.h>
+#include <intcoin/transaction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <random>
+
+namespace intcoin {
+namespace bench {
+
+namespace {
+
+constexpr char CHARSET[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+uint32_t Polymod(const std::vector<uint8_t>& values) {
+    static const uint32_t GEN[5] = {0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3};
+    uint32_t chk = 1;
+    for (uint8_t value : values) {
+        uint32_t top = chk >> 25;
+        chk = ((chk & 0x1ffffff) << 5) ^ value;
+        for (int i = 0; i < 5; ++i) {
+            if ((top >> i) & 1) {
+                chk ^= GEN[i];
+            }
+        }
+    }
+    return chk;
+}
+
+/// Bech32-encode a 32-byte hash under the mainnet HRP
+std::string EncodeAddress(const std::vector<uint8_t>& hash) {
+    const std::string hrp = "int";
+
+    std::vector<uint8_t> data;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (uint8_t byte : hash) {
+        acc = (acc << 8) | byte;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            data.push_back((acc >> bits) & 31);
+        }
+    }
+    if (bits > 0) {
+        data.push_back((acc << (5 - bits)) & 31);
+    }
+
+    std::vector<uint8_t> values;
+    for (char c : hrp) values.push_back(static_cast<uint8_t>(c) >> 5);
+    values.push_back(0);
+    for (char c : hrp) values.push_back(static_cast<uint8_t>(c) & 31);
+    values.insert(values.end(), data.begin(), data.end());
+    values.insert(values.end(), 6, 0);
+    uint32_t mod = Polymod(values) ^ 1;
+
+    std::string out = hrp + "1";
+    for (uint8_t d : data) out += CHARSET[d];
+    for (int i = 0; i < 6; ++i) out += CHARSET[(mod >> (5 * (5 - i))) & 31];
+    return out;
+}
+
+uint64_t HashKey(const uint256& hash) {
+    uint64_t key;
+    std::memcpy(&key, hash.data(), sizeof(key));
+    return key;
+}
+
+uint256 MockHash(uint64_t tag, uint64_t index) {
+    uint256 hash{};
+    std::mt19937_64 rng(tag * 0x9e3779b97f4a7c15ULL + index);
+    for (size_t i = 0; i < hash.size(); i += 8) {
+        uint64_t word = rng();
+        std::memcpy(hash.data() + i, &word, 8);
+    }
+    return hash;
+}
+
+std::mutex g_broadcast_mutex;
+MockBroadcastHandler g_broadcast_handler;
+
+}  // namespace
+
+MockWalletState& MockWallet() {
+    static MockWalletState state;
+    return state;
+}
+
+MockChainState& MockChain() {
+    static MockChainState state;
+    return state;
+}
+
+std::string MockAddress(uint64_t index) {
+    uint256 hash = MockHash(1, index);
+    return EncodeAddress(std::vector<uint8_t>(hash.begin(), hash.end()));
+}
+
+void PopulateMockWallet(size_t history_entries, uint64_t seed) {
+    MockWalletState& wallet = MockWallet();
+    wallet = MockWalletState();
+
+    MockChainState& chain = MockChain();
+    chain.best_height = 200000 + history_entries / 4;
+    chain.best_hash = MockHash(2, chain.best_height);
+
+    size_t address_count = std::max<size_t>(20, history_entries / 10);
+    wallet.addresses.reserve(address_count);
+    for (size_t i = 0; i < address_count; ++i) {
+        wallet.addresses.push_back({MockAddress(i), i % 5 == 4});
+    }
+    wallet.next_address = address_count;
+
+    std::mt19937_64 rng(seed);
+    std::lognormal_distribution<double> amounts(std::log(5e6), 2.0);
+
+    wallet.history.reserve(history_entries);
+    wallet.utxos.reserve(history_entries / 4 + 1);
+    for (size_t i = 0; i < history_entries; ++i) {
+        wallet::TxInfo tx;
+        tx.tx_hash = MockHash(3, i);
+        tx.amount = static_cast<int64_t>(std::min(amounts(rng), 1e13)) + 1;
+        tx.is_incoming = rng() % 3 != 0;
+        if (!tx.is_incoming) {
+            tx.amount = -tx.amount;
+        }
+        // Newest first, a few per block, the latest few unconfirmed
+        tx.block_height = i < 3 ? 0 : chain.best_height - i / 4;
+        tx.timestamp = 1700000000 + (history_entries - i) * 150;
+
+        if (i % 4 == 0) {
+            wallet::UTXO utxo;
+            utxo.outpoint.tx_hash = tx.tx_hash;
+            utxo.outpoint.index = 0;
+            utxo.value = static_cast<uint64_t>(tx.amount < 0 ? -tx.amount : tx.amount);
+            utxo.block_height = tx.block_height;
+            utxo.address = wallet.addresses[rng() % address_count].address;
+            wallet.utxos.push_back(utxo);
+        }
+
+        wallet.history_by_hash[HashKey(tx.tx_hash)] = i;
+        wallet.history.push_back(tx);
+    }
+}
+
+void SetMockBroadcastHandler(MockBroadcastHandler handler) {
+    std::lock_guard<std::mutex> lock(g_broadcast_mutex);
+    g_broadcast_handler = std::move(handler);
+}
+
+}  // namespace bench
+
+// ========================================
+// SPVClient
+// ========================================
+
+using bench::MockChain;
+using bench::MockWallet;
+
+SPVClient::SPVClient(std::shared_ptr<BlockchainDB>) {}
+
+void SPVClient::SetBloomFilter(const BloomFilter&) {
+    ++MockChain().filters_loaded;
+}
+
+void SPVClient::ClearBloomFilter() {}
+
+void SPVClient::AddWatchAddress(const std::string&) {}
+
+Result<void> SPVClient::StartSync() {
+    MockChain().syncing = true;
+    return Result<void>::Ok();
+}
+
+void SPVClient::StopSync() {
+    MockChain().syncing = false;
+}
+
+bool SPVClient::IsSyncing() const {
+    return MockChain().syncing;
+}
+
+uint64_t SPVClient::GetBestHeight() const {
+    return MockChain().best_height;
+}
+
+uint256 SPVClient::GetBestHash() const {
+    return MockChain().best_hash;
+}
+
+uint64_t SPVClient::GetNetworkBestHeight() const {
+    return MockChain().best_height;
+}
+
+double SPVClient::GetSyncProgress() const {
+    return 1.0;
+}
+
+size_t SPVClient::GetPeerCount() const {
+    return MockChain().peer_count;
+}
+
+Result<BlockHeader> SPVClient::GetHeader(const uint256&) const {
+    return Result<BlockHeader>::Error("Header not found");
+}
+
+std::vector<BlockHeader> SPVClient::GetHeadersInRange(uint64_t, uint64_t) const {
+    return {};
+}
+
+Result<void> SPVClient::BroadcastTransaction(const std::vector<uint8_t>& raw_tx) {
+    bench::MockBroadcastHandler handler;
+    {
+        std::lock_guard<std::mutex> lock(bench::g_broadcast_mutex);
+        handler = bench::g_broadcast_handler;
+    }
+    if (handler) {
+        return handler(raw_tx);
+    }
+    return Result<void>::Ok();
+}
+
+// ========================================
+// wallet::Wallet
+// ========================================
+
+namespace wallet {
+
+Wallet::Wallet(const WalletConfig&) {}
+
+Result<void> Wallet::CreateFromMnemonic(const std::string&, const std::string&) {
+    return Result<void>::Ok();
+}
+
+Result<void> Wallet::Load(const std::string&) {
+    return Result<void>::Ok();
+}
+
+Result<void> Wallet::BackupWallet(const std::string&) {
+    return Result<void>::Ok();
+}
+
+Result<void> Wallet::RestoreFromBackup(const std::string&) {
+    return Result<void>::Ok();
+}
+
+Result<std::string> Wallet::GetNewAddress() {
+    auto& state = MockWallet();
+    std::string address = bench::MockAddress(state.next_address++);
+    state.addresses.push_back({address, false});
+    return Result<std::string>::Ok(address);
+}
+
+Result<std::string> Wallet::GetChangeAddress() {
+    auto& state = MockWallet();
+    std::string address = bench::MockAddress(state.next_address++);
+    state.addresses.push_back({address, true});
+    return Result<std::string>::Ok(address);
+}
+
+Result<std::vector<AddressInfo>> Wallet::GetAddresses() {
+    return Result<std::vector<AddressInfo>>::Ok(MockWallet().addresses);
+}
+
+Result<uint64_t> Wallet::GetBalance() {
+    uint64_t balance = 0;
+    for (const auto& utxo : MockWallet().utxos) {
+        if (utxo.block_height > 0) {
+            balance += utxo.value;
+        }
+    }
+    return Result<uint64_t>::Ok(balance);
+}
+
+Result<uint64_t> Wallet::GetUnconfirmedBalance() {
+    uint64_t balance = 0;
+    for (const auto& utxo : MockWallet().utxos) {
+        if (utxo.block_height == 0) {
+            balance += utxo.value;
+        }
+    }
+    return Result<uint64_t>::Ok(balance);
+}
+
+Result<std::vector<UTXO>> Wallet::GetUTXOs() {
+    return Result<std::vector<UTXO>>::Ok(MockWallet().utxos);
+}
+
+Result<std::vector<TxInfo>> Wallet::GetTransactionHistory() {
+    return Result<std::vector<TxInfo>>::Ok(MockWallet().history);
+}
+
+Result<TxInfo> Wallet::GetTransaction(const uint256& tx_hash) {
+    const auto& state = MockWallet();
+    auto it = state.history_by_hash.find(bench::HashKey(tx_hash));
+    if (it == state.history_by_hash.end()) {
+        return Result<TxInfo>::Error("Transaction not found");
+    }
+    return Result<TxInfo>::Ok(state.history[it->second]);
+}
+
+Result<Transaction> Wallet::CreateTransaction(const SendRequest&) {
+    return Result<Transaction>::Error("Not available in the mock wallet");
+}
+
+Result<Transaction> Wallet::SignTransaction(const Transaction& tx) {
+    // Dilithium5 key and signature sizes, tied to the outpoint so inputs differ
+    Transaction signed_tx = tx;
+    for (auto& input : signed_tx.inputs) {
+        input.public_key.assign(2592, 0x02);
+        input.signature.assign(4627, 0);
+        std::memcpy(input.signature.data(), input.prev_tx_hash.data(), input.prev_tx_hash.size());
+    }
+    return Result<Transaction>::Ok(signed_tx);
+}
+
+}  // namespace wallet
+}  // namespace intcoin
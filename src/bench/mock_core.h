@@ -0,0 +1,76 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// In-process stand-ins for the core SPVClient and wallet::Wallet.
+//
+// mock_core.cpp defines the member functions the mobile sources call on
+// both classes. A bench binary links it in place of the core's spv and
+// wallet objects, so SDK and RPC code runs unchanged against data held
+// in memory, with no peers, disk wallet or key derivation. The classes
+// themselves carry no extra members, so the mock state is process-wide.
+
+#ifndef INTCOIN_BENCH_MOCK_CORE_H
+#define INTCOIN_BENCH_MOCK_CORE_H
+
+#include <intcoin/types.h>
+#include <intcoin/wallet.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace intcoin {
+namespace bench {
+
+/// Data served by the mock wallet
+struct MockWalletState {
+    std::vector<wallet::AddressInfo> addresses;
+    std::vector<wallet::UTXO> utxos;
+    std::vector<wallet::TxInfo> history;  // Newest first
+
+    /// First 8 bytes of a tx hash to its history position
+    std::unordered_map<uint64_t, size_t> history_by_hash;
+
+    /// Index of the next address handed out by GetNewAddress
+    uint64_t next_address = 0;
+};
+
+/// Data served by the mock SPV client
+struct MockChainState {
+    uint64_t best_height = 0;
+    uint256 best_hash{};
+    size_t peer_count = 8;
+    bool syncing = false;
+
+    /// Bloom filters the SDK has loaded so far
+    uint64_t filters_loaded = 0;
+};
+
+MockWalletState& MockWallet();
+MockChainState& MockChain();
+
+/// Deterministic mainnet address
+/// @param index Address number
+std::string MockAddress(uint64_t index);
+
+/// Refill the mock wallet and chain
+/// Sizes follow a busy merchant wallet: a quarter of the transactions
+/// left an unspent output, and one address in ten was reused.
+/// @param history_entries Transactions in the wallet history
+/// @param seed Seed for amounts and heights
+void PopulateMockWallet(size_t history_entries, uint64_t seed = 1);
+
+/// Relays SPVClient::BroadcastTransaction somewhere real
+/// Called on the SDK broadcast queue's worker thread.
+using MockBroadcastHandler = std::function<Result<void>(const std::vector<uint8_t>& raw_tx)>;
+
+/// Route broadcasts to a handler (empty = accept without relaying)
+void SetMockBroadcastHandler(MockBroadcastHandler handler);
+
+}  // namespace bench
+}  // namespace intcoin
+
+#endif  // INTCOIN_BENCH_MOCK_CORE_H
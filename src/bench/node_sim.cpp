@@ -0,0 +1,1142 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include "node_sim.h"
+
+#include <intcoin/crypto.h>
+#include <intcoin/mobile_raw_tx.h>
+#include <intcoin/mobile_tx_builder.h>
+#include <intcoin/transaction.h>
+#include <intcoin/util.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <random>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace intcoin {
+namespace bench {
+
+namespace {
+
+using SteadyClock = std::chrono::steady_clock;
+
+constexpr uint8_t FRAME_MAGIC[4] = {'I', 'N', 'T', 'S'};
+constexpr size_t COMMAND_SIZE = 12;
+constexpr size_t FRAME_HEADER_SIZE = 4 + COMMAND_SIZE + 4 + 4;
+
+/// Largest payload either side accepts
+constexpr uint32_t MAX_FRAME_PAYLOAD = 32 * 1024 * 1024;
+
+/// Most headers in one headers message
+constexpr uint32_t MAX_HEADERS_PER_MESSAGE = 2000;
+
+/// Largest HTTP request the RPC server reads
+constexpr size_t MAX_HTTP_REQUEST = 8 * 1024 * 1024;
+
+/// Timestamp of the genesis block and spacing of the ones after it
+constexpr uint64_t GENESIS_TIME = 1700000000;
+constexpr uint64_t BLOCK_SPACING = 120;
+
+constexpr uint32_t SIM_BITS = 0x1d00ffff;
+
+/// Fee rate quoted by estimatesmartfee, in INTS per byte
+constexpr uint64_t SIM_FEE_RATE = 10;
+
+void PutLE32(std::vector<uint8_t>* out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out->push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+void PutLE64(std::vector<uint8_t>* out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) out->push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+uint32_t GetLE32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint64_t GetLE64(const uint8_t* p) {
+    return static_cast<uint64_t>(GetLE32(p)) | (static_cast<uint64_t>(GetLE32(p + 4)) << 32);
+}
+
+uint64_t HashKey(const uint256& hash) {
+    uint64_t key;
+    std::memcpy(&key, hash.data(), sizeof(key));
+    return key;
+}
+
+std::string HashHex(const uint256& hash) {
+    return BytesToHex(std::vector<uint8_t>(hash.begin(), hash.end()));
+}
+
+bool HexToBytes(const std::string& hex, std::vector<uint8_t>* out) {
+    if (hex.size() % 2 != 0) {
+        return false;
+    }
+    out->clear();
+    out->reserve(hex.size() / 2);
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        unsigned value = 0;
+        for (size_t j = 0; j < 2; ++j) {
+            char c = hex[i + j];
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= static_cast<unsigned>(c - '0');
+            else if (c >= 'a' && c <= 'f') value |= static_cast<unsigned>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') value |= static_cast<unsigned>(c - 'A' + 10);
+            else return false;
+        }
+        out->push_back(static_cast<uint8_t>(value));
+    }
+    return true;
+}
+
+bool HexToHash(const std::string& hex, uint256* hash) {
+    std::vector<uint8_t> bytes;
+    if (!HexToBytes(hex, &bytes) || bytes.size() != hash->size()) {
+        return false;
+    }
+    std::copy(bytes.begin(), bytes.end(), hash->begin());
+    return true;
+}
+
+bool ReadExact(int fd, uint8_t* data, size_t size) {
+    while (size > 0) {
+        ssize_t n = ::recv(fd, data, size, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool WriteAll(int fd, const uint8_t* data, size_t size) {
+    while (size > 0) {
+        ssize_t n = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+void SetNoDelay(int fd) {
+    int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+/// Read one frame, checking magic, size and checksum
+bool ReadFrame(int fd, std::string* command, std::vector<uint8_t>* payload) {
+    uint8_t header[FRAME_HEADER_SIZE];
+    if (!ReadExact(fd, header, sizeof(header)) || std::memcmp(header, FRAME_MAGIC, 4) != 0) {
+        return false;
+    }
+
+    const char* name = reinterpret_cast<const char*>(header + 4);
+    command->assign(name, strnlen(name, COMMAND_SIZE));
+
+    uint32_t length = GetLE32(header + 4 + COMMAND_SIZE);
+    if (length > MAX_FRAME_PAYLOAD) {
+        return false;
+    }
+    payload->resize(length);
+    if (length > 0 && !ReadExact(fd, payload->data(), length)) {
+        return false;
+    }
+
+    uint256 checksum = SHA3::Hash(payload->data(), payload->size());
+    return std::memcmp(checksum.data(), header + 4 + COMMAND_SIZE + 4, 4) == 0;
+}
+
+int ConnectLoopback(uint16_t port) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    SetNoDelay(fd);
+    return fd;
+}
+
+/// Bind a loopback listener
+/// @param port Port to bind (0 = any), set to the bound port
+int ListenLoopback(uint16_t* port) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int one = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(*port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(fd, 64) != 0 ||
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    *port = ntohs(addr.sin_port);
+    return fd;
+}
+
+/// Read one HTTP request body, keeping any pipelined bytes in buffer
+bool ReadHttpRequest(int fd, std::string* buffer, std::string* body) {
+    char chunk[16384];
+    size_t header_end;
+    while ((header_end = buffer->find("\r\n\r\n")) == std::string::npos) {
+        ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0 || buffer->size() > MAX_HTTP_REQUEST) {
+            return false;
+        }
+        buffer->append(chunk, static_cast<size_t>(n));
+    }
+
+    std::string headers = buffer->substr(0, header_end);
+    std::transform(headers.begin(), headers.end(), headers.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    size_t content_length = 0;
+    size_t field = headers.find("content-length:");
+    if (field != std::string::npos) {
+        content_length = std::strtoull(headers.c_str() + field + 15, nullptr, 10);
+    }
+    if (content_length > MAX_HTTP_REQUEST) {
+        return false;
+    }
+
+    size_t body_start = header_end + 4;
+    while (buffer->size() < body_start + content_length) {
+        ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) {
+            return false;
+        }
+        buffer->append(chunk, static_cast<size_t>(n));
+    }
+
+    *body = buffer->substr(body_start, content_length);
+    buffer->erase(0, body_start + content_length);
+    return true;
+}
+
+// ----------------------------------------
+// Minimal JSON for the RPC server
+// ----------------------------------------
+
+void SkipSpace(const std::string& s, size_t* pos) {
+    while (*pos < s.size() && (s[*pos] == ' ' || s[*pos] == '\t' || s[*pos] == '\r' || s[*pos] == '\n')) {
+        ++*pos;
+    }
+}
+
+/// Extent of the JSON value starting at pos (strings, numbers, literals,
+/// arrays and objects; escapes are skipped, not decoded)
+size_t ValueEnd(const std::string& s, size_t pos) {
+    if (pos >= s.size()) {
+        return pos;
+    }
+    if (s[pos] == '"') {
+        for (++pos; pos < s.size(); ++pos) {
+            if (s[pos] == '\\') ++pos;
+            else if (s[pos] == '"') return pos + 1;
+        }
+        return s.size();
+    }
+    if (s[pos] == '[' || s[pos] == '{') {
+        int depth = 0;
+        for (; pos < s.size(); ++pos) {
+            if (s[pos] == '"') {
+                pos = ValueEnd(s, pos) - 1;
+            } else if (s[pos] == '[' || s[pos] == '{') {
+                ++depth;
+            } else if ((s[pos] == ']' || s[pos] == '}') && --depth == 0) {
+                return pos + 1;
+            }
+        }
+        return s.size();
+    }
+    while (pos < s.size() && s[pos] != ',' && s[pos] != '}' && s[pos] != ']' && s[pos] != ' ') {
+        ++pos;
+    }
+    return pos;
+}
+
+/// Raw JSON text of a top-level member of an object
+std::string Member(const std::string& object, const std::string& key) {
+    std::string quoted = "\"" + key + "\"";
+    size_t pos = object.find(quoted);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += quoted.size();
+    SkipSpace(object, &pos);
+    if (pos >= object.size() || object[pos] != ':') {
+        return "";
+    }
+    ++pos;
+    SkipSpace(object, &pos);
+    return object.substr(pos, ValueEnd(object, pos) - pos);
+}
+
+/// Elements of a JSON array, with string quotes removed
+std::vector<std::string> ArrayItems(const std::string& array) {
+    std::vector<std::string> items;
+    if (array.size() < 2 || array.front() != '[') {
+        return items;
+    }
+    size_t pos = 1;
+    while (true) {
+        SkipSpace(array, &pos);
+        if (pos >= array.size() || array[pos] == ']') {
+            break;
+        }
+        size_t end = ValueEnd(array, pos);
+        std::string item = array.substr(pos, end - pos);
+        if (item.size() >= 2 && item.front() == '"') {
+            item = item.substr(1, item.size() - 2);
+        }
+        items.push_back(item);
+        pos = end;
+        SkipSpace(array, &pos);
+        if (pos < array.size() && array[pos] == ',') {
+            ++pos;
+        }
+    }
+    return items;
+}
+
+std::string Unquote(const std::string& value) {
+    if (value.size() >= 2 && value.front() == '"') {
+        return value.substr(1, value.size() - 2);
+    }
+    return value;
+}
+
+}  // namespace
+
+// ========================================
+// Wire format
+// ========================================
+
+std::vector<uint8_t> SimHeader::Serialize() const {
+    std::vector<uint8_t> out;
+    out.reserve(SIM_HEADER_SIZE);
+    PutLE32(&out, version);
+    out.insert(out.end(), prev_hash.begin(), prev_hash.end());
+    out.insert(out.end(), commitment.begin(), commitment.end());
+    PutLE64(&out, timestamp);
+    PutLE32(&out, bits);
+    PutLE32(&out, nonce);
+    return out;
+}
+
+SimHeader SimHeader::Deserialize(const uint8_t* data) {
+    SimHeader header;
+    header.version = GetLE32(data);
+    std::memcpy(header.prev_hash.data(), data + 4, 32);
+    std::memcpy(header.commitment.data(), data + 36, 32);
+    header.timestamp = GetLE64(data + 68);
+    header.bits = GetLE32(data + 76);
+    header.nonce = GetLE32(data + 80);
+    return header;
+}
+
+uint256 SimHeader::GetHash() const {
+    return SHA3::Hash(Serialize());
+}
+
+std::vector<uint8_t> EncodeSimFrame(const std::string& command, const std::vector<uint8_t>& payload) {
+    std::vector<uint8_t> frame;
+    frame.reserve(FRAME_HEADER_SIZE + payload.size());
+    frame.insert(frame.end(), FRAME_MAGIC, FRAME_MAGIC + 4);
+    for (size_t i = 0; i < COMMAND_SIZE; ++i) {
+        frame.push_back(i < command.size() ? static_cast<uint8_t>(command[i]) : 0);
+    }
+    PutLE32(&frame, static_cast<uint32_t>(payload.size()));
+    uint256 checksum = SHA3::Hash(payload.data(), payload.size());
+    frame.insert(frame.end(), checksum.begin(), checksum.begin() + 4);
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    return frame;
+}
+
+// ========================================
+// NodeSimulator
+// ========================================
+
+/// Accepted socket with its reader and paced writer
+struct NodeSimulator::Connection {
+    int fd = -1;
+    std::thread reader;
+    std::thread writer;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool closed = false;
+
+    struct Pending {
+        SteadyClock::time_point due;
+        std::vector<uint8_t> bytes;
+    };
+    std::deque<Pending> outbox;  // Due times are non-decreasing
+};
+
+NodeSimulator::NodeSimulator(NodeSimConfig config)
+    : config_(std::move(config)) {
+    latency_us_ = config_.latency.count();
+    bandwidth_ = config_.bandwidth_bytes_per_sec;
+
+    std::lock_guard<std::mutex> lock(chain_mutex_);
+    uint64_t length = std::max<uint64_t>(1, config_.chain_length);
+    chain_.reserve(length);
+    for (uint64_t i = 0; i < length; ++i) {
+        AppendBlockLocked();
+    }
+}
+
+NodeSimulator::~NodeSimulator() {
+    Stop();
+}
+
+std::shared_ptr<const SimBlock> NodeSimulator::MakeBlock(uint64_t height, const uint256& prev_hash) {
+    // Same seed, height and branch give the same block
+    std::mt19937_64 rng(config_.seed * 0x9e3779b97f4a7c15ULL ^ (height << 16) ^ branch_);
+
+    auto block = std::make_shared<SimBlock>();
+    block->height = height;
+
+    std::vector<uint8_t> txids;
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    if (height > 0 && !config_.wallet_addresses.empty() && config_.max_wallet_txs_per_block > 0 &&
+        unit(rng) < config_.wallet_block_rate) {
+        size_t count = 1 + rng() % config_.max_wallet_txs_per_block;
+        for (size_t i = 0; i < count; ++i) {
+            mobile::TxInputCoin coin;
+            for (size_t j = 0; j < coin.tx_hash.size(); j += 8) {
+                uint64_t word = rng();
+                std::memcpy(coin.tx_hash.data() + j, &word, 8);
+            }
+            coin.output_index = static_cast<uint32_t>(rng() % 4);
+            coin.amount = 0;
+
+            const std::string& address = config_.wallet_addresses[rng() % config_.wallet_addresses.size()];
+            uint64_t amount = 10000 + rng() % 1000000000;
+            auto tx_result = mobile::BuildUnsignedTransaction({coin}, {{address, amount}}, address, 0);
+            if (tx_result.IsError()) {
+                continue;
+            }
+
+            std::vector<uint8_t> raw = tx_result.GetValue().Serialize();
+            uint256 txid = SHA3::Hash(raw);
+            txids.insert(txids.end(), txid.begin(), txid.end());
+            block->txs.push_back(std::move(raw));
+        }
+    }
+
+    block->header.prev_hash = prev_hash;
+    block->header.commitment = SHA3::Hash(txids);
+    block->header.timestamp = GENESIS_TIME + height * BLOCK_SPACING + rng() % 60;
+    block->header.bits = SIM_BITS;
+    block->header.nonce = static_cast<uint32_t>(rng());
+    block->hash = block->header.GetHash();
+    return block;
+}
+
+void NodeSimulator::AppendBlockLocked() {
+    uint64_t height = chain_.size();
+    uint256 prev_hash = chain_.empty() ? uint256{} : chain_.back()->hash;
+    auto block = MakeBlock(height, prev_hash);
+    blocks_[HashKey(block->hash)] = block;
+    chain_.push_back(std::move(block));
+}
+
+void NodeSimulator::ReorgLocked(uint32_t depth) {
+    // Genesis stays
+    depth = static_cast<uint32_t>(std::min<uint64_t>(depth, chain_.size() - 1));
+    if (depth == 0) {
+        return;
+    }
+
+    // Stale blocks stay in blocks_ so peers can still fetch them
+    chain_.resize(chain_.size() - depth);
+    ++branch_;
+    for (uint32_t i = 0; i <= depth; ++i) {
+        AppendBlockLocked();
+    }
+
+    std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+    ++stats_.reorgs;
+}
+
+void NodeSimulator::MineBlocks(size_t count) {
+    std::lock_guard<std::mutex> lock(chain_mutex_);
+    for (size_t i = 0; i < count; ++i) {
+        AppendBlockLocked();
+        if (config_.reorg_interval > 0 && ++mined_since_reorg_ >= config_.reorg_interval) {
+            mined_since_reorg_ = 0;
+            ReorgLocked(config_.reorg_depth);
+        }
+    }
+}
+
+void NodeSimulator::Reorg(uint32_t depth) {
+    std::lock_guard<std::mutex> lock(chain_mutex_);
+    ReorgLocked(depth);
+}
+
+uint64_t NodeSimulator::GetHeight() const {
+    std::lock_guard<std::mutex> lock(chain_mutex_);
+    return chain_.size() - 1;
+}
+
+uint256 NodeSimulator::GetTipHash() const {
+    std::lock_guard<std::mutex> lock(chain_mutex_);
+    return chain_.back()->hash;
+}
+
+std::shared_ptr<const SimBlock> NodeSimulator::GetBlock(uint64_t height) const {
+    std::lock_guard<std::mutex> lock(chain_mutex_);
+    return height < chain_.size() ? chain_[height] : nullptr;
+}
+
+void NodeSimulator::SetLatency(std::chrono::microseconds latency) {
+    latency_us_ = latency.count();
+}
+
+void NodeSimulator::SetBandwidth(uint64_t bytes_per_sec) {
+    bandwidth_ = bytes_per_sec;
+}
+
+bool NodeSimulator::WaitForTransaction(const uint256& txid, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(tx_mutex_);
+    return tx_cv_.wait_for(lock, timeout, [&] { return mempool_.count(txid) > 0; });
+}
+
+NodeSimStats NodeSimulator::GetStats() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+}
+
+Result<void> NodeSimulator::Start() {
+    if (running_) {
+        return Result<void>::Error("Simulator already running");
+    }
+
+    p2p_port_ = config_.p2p_port;
+    rpc_port_ = config_.rpc_port;
+    p2p_listener_ = ListenLoopback(&p2p_port_);
+    if (p2p_listener_ < 0) {
+        return Result<void>::Error("Failed to listen on P2P port: " + std::string(std::strerror(errno)));
+    }
+    rpc_listener_ = ListenLoopback(&rpc_port_);
+    if (rpc_listener_ < 0) {
+        ::close(p2p_listener_);
+        p2p_listener_ = -1;
+        return Result<void>::Error("Failed to listen on RPC port: " + std::string(std::strerror(errno)));
+    }
+
+    running_ = true;
+    p2p_accept_thread_ = std::thread(&NodeSimulator::AcceptLoop, this, p2p_listener_, false);
+    rpc_accept_thread_ = std::thread(&NodeSimulator::AcceptLoop, this, rpc_listener_, true);
+    return Result<void>::Ok();
+}
+
+void NodeSimulator::Stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    // Shutdown wakes the blocked accept() calls
+    ::shutdown(p2p_listener_, SHUT_RDWR);
+    ::shutdown(rpc_listener_, SHUT_RDWR);
+    p2p_accept_thread_.join();
+    rpc_accept_thread_.join();
+    ::close(p2p_listener_);
+    ::close(rpc_listener_);
+    p2p_listener_ = -1;
+    rpc_listener_ = -1;
+
+    std::vector<std::shared_ptr<Connection>> connections;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        connections.swap(connections_);
+    }
+    for (auto& connection : connections) {
+        {
+            std::lock_guard<std::mutex> lock(connection->mutex);
+            connection->closed = true;
+        }
+        connection->cv.notify_all();
+        ::shutdown(connection->fd, SHUT_RDWR);
+        connection->reader.join();
+        connection->writer.join();
+        ::close(connection->fd);
+    }
+}
+
+void NodeSimulator::AcceptLoop(int listener, bool rpc) {
+    while (running_) {
+        int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        SetNoDelay(fd);
+
+        auto connection = std::make_shared<Connection>();
+        connection->fd = fd;
+
+        // Reap connections the peer has closed (RPC clients open one per call)
+        std::vector<std::shared_ptr<Connection>> finished;
+        {
+            std::lock_guard<std::mutex> lock(connections_mutex_);
+            if (!running_) {
+                ::close(fd);
+                break;
+            }
+            auto done = std::partition(connections_.begin(), connections_.end(), [](const auto& c) {
+                std::lock_guard<std::mutex> c_lock(c->mutex);
+                return !c->closed;
+            });
+            finished.assign(done, connections_.end());
+            connections_.erase(done, connections_.end());
+            connections_.push_back(connection);
+        }
+        for (auto& old : finished) {
+            old->reader.join();
+            old->writer.join();
+            ::close(old->fd);
+        }
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            if (!rpc) ++stats_.p2p_connections;
+        }
+
+        connection->writer = std::thread(&NodeSimulator::WriterLoop, this, connection);
+        if (rpc) {
+            connection->reader = std::thread(&NodeSimulator::ServeRPC, this, connection);
+        } else {
+            connection->reader = std::thread(&NodeSimulator::ServeP2P, this, connection);
+        }
+    }
+}
+
+void NodeSimulator::Respond(Connection& connection, std::vector<uint8_t> bytes) {
+    SteadyClock::time_point due = SteadyClock::now() + std::chrono::microseconds(latency_us_.load());
+    {
+        std::lock_guard<std::mutex> lock(connection.mutex);
+        // Latency only changes between runs; keep the queue ordered regardless
+        if (!connection.outbox.empty()) {
+            due = std::max(due, connection.outbox.back().due);
+        }
+        connection.outbox.push_back({due, std::move(bytes)});
+    }
+    connection.cv.notify_all();
+}
+
+void NodeSimulator::WriterLoop(std::shared_ptr<Connection> connection) {
+    // Earliest time the link is free after the previous response
+    SteadyClock::time_point link_free = SteadyClock::now();
+
+    std::unique_lock<std::mutex> lock(connection->mutex);
+    while (true) {
+        connection->cv.wait(lock, [&] { return connection->closed || !connection->outbox.empty(); });
+        if (connection->closed) {
+            return;
+        }
+
+        // The response occupies the link for size / bandwidth and arrives
+        // whole once the last byte is through
+        const Connection::Pending& next = connection->outbox.front();
+        SteadyClock::time_point deliver_at = std::max(next.due, link_free);
+        uint64_t bandwidth = bandwidth_;
+        if (bandwidth > 0) {
+            deliver_at += std::chrono::microseconds(next.bytes.size() * 1000000 / bandwidth);
+        }
+        link_free = deliver_at;
+
+        if (connection->cv.wait_until(lock, deliver_at, [&] { return connection->closed; })) {
+            return;
+        }
+
+        std::vector<uint8_t> bytes = std::move(connection->outbox.front().bytes);
+        connection->outbox.pop_front();
+        lock.unlock();
+
+        bool sent = WriteAll(connection->fd, bytes.data(), bytes.size());
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            stats_.bytes_sent += bytes.size();
+        }
+
+        lock.lock();
+        if (!sent) {
+            connection->closed = true;
+            return;
+        }
+    }
+}
+
+void NodeSimulator::ServeP2P(std::shared_ptr<Connection> connection) {
+    std::string command;
+    std::vector<uint8_t> payload;
+    while (running_ && ReadFrame(connection->fd, &command, &payload)) {
+        if (command == "version") {
+            std::vector<uint8_t> version;
+            PutLE64(&version, GetHeight());
+            Respond(*connection, EncodeSimFrame("version", version));
+            Respond(*connection, EncodeSimFrame("verack", {}));
+        } else if (command == "getheaders") {
+            Respond(*connection, EncodeSimFrame("headers", HandleGetHeaders(payload)));
+        } else if (command == "getblock") {
+            std::vector<uint8_t> block = HandleGetBlock(payload);
+            Respond(*connection, EncodeSimFrame(block.empty() ? "notfound" : "block",
+                                                block.empty() ? payload : block));
+        } else if (command == "tx") {
+            std::string error;
+            std::vector<uint8_t> txid = HandleTx(payload, &error);
+            if (txid.empty()) {
+                Respond(*connection, EncodeSimFrame("reject", std::vector<uint8_t>(error.begin(), error.end())));
+            } else {
+                Respond(*connection, EncodeSimFrame("accepted", txid));
+            }
+        } else if (command == "ping") {
+            Respond(*connection, EncodeSimFrame("pong", payload));
+        }
+        // Unknown commands are ignored, as a node ignores unknown messages
+    }
+
+    std::lock_guard<std::mutex> lock(connection->mutex);
+    connection->closed = true;
+    connection->cv.notify_all();
+}
+
+std::vector<uint8_t> NodeSimulator::HandleGetHeaders(const std::vector<uint8_t>& payload) {
+    std::vector<uint8_t> out;
+    std::vector<std::shared_ptr<const SimBlock>> headers;
+    uint64_t start = 0;
+
+    if (payload.size() >= 4) {
+        uint32_t locator_count = GetLE32(payload.data());
+        if (payload.size() == 4 + static_cast<size_t>(locator_count) * 32 + 4) {
+            uint32_t max = std::min(GetLE32(payload.data() + 4 + locator_count * 32), MAX_HEADERS_PER_MESSAGE);
+
+            std::lock_guard<std::mutex> lock(chain_mutex_);
+
+            // First locator entry on the active chain; unknown locators
+            // fall back to genesis, which every chain shares
+            start = locator_count == 0 ? 0 : 1;
+            for (uint32_t i = 0; i < locator_count; ++i) {
+                uint256 hash;
+                std::memcpy(hash.data(), payload.data() + 4 + i * 32, 32);
+                auto it = blocks_.find(HashKey(hash));
+                if (it != blocks_.end() && it->second->hash == hash && it->second->height < chain_.size() &&
+                    chain_[it->second->height] == it->second) {
+                    start = it->second->height + 1;
+                    break;
+                }
+            }
+
+            for (uint64_t h = start; h < chain_.size() && headers.size() < max; ++h) {
+                headers.push_back(chain_[h]);
+            }
+        }
+    }
+
+    out.reserve(12 + headers.size() * SIM_HEADER_SIZE);
+    PutLE64(&out, start);
+    PutLE32(&out, static_cast<uint32_t>(headers.size()));
+    for (const auto& block : headers) {
+        std::vector<uint8_t> header = block->header.Serialize();
+        out.insert(out.end(), header.begin(), header.end());
+    }
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_.headers_served += headers.size();
+    return out;
+}
+
+std::vector<uint8_t> NodeSimulator::HandleGetBlock(const std::vector<uint8_t>& payload) {
+    if (payload.size() != 32) {
+        return {};
+    }
+    uint256 hash;
+    std::memcpy(hash.data(), payload.data(), 32);
+
+    std::shared_ptr<const SimBlock> block;
+    {
+        std::lock_guard<std::mutex> lock(chain_mutex_);
+        auto it = blocks_.find(HashKey(hash));
+        if (it == blocks_.end() || it->second->hash != hash) {
+            return {};
+        }
+        block = it->second;
+    }
+
+    std::vector<uint8_t> out = block->header.Serialize();
+    PutLE32(&out, static_cast<uint32_t>(block->txs.size()));
+    for (const auto& tx : block->txs) {
+        PutLE32(&out, static_cast<uint32_t>(tx.size()));
+        out.insert(out.end(), tx.begin(), tx.end());
+    }
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    ++stats_.blocks_served;
+    return out;
+}
+
+std::vector<uint8_t> NodeSimulator::HandleTx(const std::vector<uint8_t>& payload, std::string* error) {
+    auto view_result = mobile::RawTransactionView::Parse(payload.data(), payload.size());
+    if (view_result.IsError()) {
+        *error = view_result.error;
+        return {};
+    }
+    const uint256& txid = view_result.GetValue().GetHash();
+
+    {
+        std::lock_guard<std::mutex> lock(tx_mutex_);
+        mempool_.emplace(txid, payload);
+    }
+    tx_cv_.notify_all();
+
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        ++stats_.txs_accepted;
+    }
+    return std::vector<uint8_t>(txid.begin(), txid.end());
+}
+
+void NodeSimulator::ServeRPC(std::shared_ptr<Connection> connection) {
+    std::string buffer;
+    std::string request;
+    while (running_ && ReadHttpRequest(connection->fd, &buffer, &request)) {
+        std::string body = HandleRPC(request);
+        std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                               std::to_string(body.size()) + "\r\nConnection: keep-alive\r\n\r\n" + body;
+        Respond(*connection, std::vector<uint8_t>(response.begin(), response.end()));
+    }
+
+    std::lock_guard<std::mutex> lock(connection->mutex);
+    connection->closed = true;
+    connection->cv.notify_all();
+}
+
+std::string NodeSimulator::HandleRPC(const std::string& body) {
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        ++stats_.rpc_requests;
+    }
+
+    std::string id = Member(body, "id");
+    if (id.empty()) {
+        id = "null";
+    }
+    std::string method = Unquote(Member(body, "method"));
+    std::vector<std::string> params = ArrayItems(Member(body, "params"));
+
+    auto reply = [&](const std::string& result) {
+        return "{\"result\":" + result + ",\"error\":null,\"id\":" + id + "}";
+    };
+    auto fail = [&](int code, const std::string& message) {
+        return "{\"result\":null,\"error\":{\"code\":" + std::to_string(code) + ",\"message\":\"" + message +
+               "\"},\"id\":" + id + "}";
+    };
+
+    if (method == "getblockcount") {
+        return reply(std::to_string(GetHeight()));
+    }
+    if (method == "getbestblockhash") {
+        return reply("\"" + HashHex(GetTipHash()) + "\"");
+    }
+    if (method == "getblockhash") {
+        if (params.empty()) {
+            return fail(-8, "Missing height");
+        }
+        auto block = GetBlock(std::strtoull(params[0].c_str(), nullptr, 10));
+        if (!block) {
+            return fail(-8, "Block height out of range");
+        }
+        return reply("\"" + HashHex(block->hash) + "\"");
+    }
+    if (method == "getblockheader") {
+        uint256 hash;
+        if (params.empty() || !HexToHash(params[0], &hash)) {
+            return fail(-8, "Invalid block hash");
+        }
+        std::shared_ptr<const SimBlock> block;
+        uint64_t tip = 0;
+        bool active = false;
+        {
+            std::lock_guard<std::mutex> lock(chain_mutex_);
+            auto it = blocks_.find(HashKey(hash));
+            if (it != blocks_.end() && it->second->hash == hash) {
+                block = it->second;
+                tip = chain_.size() - 1;
+                active = block->height <= tip && chain_[block->height] == block;
+            }
+        }
+        if (!block) {
+            return fail(-5, "Block not found");
+        }
+        // Stale blocks report -1 confirmations, as a node does
+        long long confirmations = active ? static_cast<long long>(tip - block->height + 1) : -1;
+        return reply("{\"hash\":\"" + HashHex(block->hash) + "\",\"height\":" + std::to_string(block->height) +
+                     ",\"confirmations\":" + std::to_string(confirmations) +
+                     ",\"previousblockhash\":\"" + HashHex(block->header.prev_hash) +
+                     "\",\"time\":" + std::to_string(block->header.timestamp) +
+                     ",\"nTx\":" + std::to_string(block->txs.size()) + "}");
+    }
+    if (method == "sendrawtransaction") {
+        std::vector<uint8_t> raw;
+        if (params.empty() || !HexToBytes(params[0], &raw)) {
+            return fail(-22, "TX decode failed");
+        }
+        std::string error;
+        std::vector<uint8_t> txid = HandleTx(raw, &error);
+        if (txid.empty()) {
+            return fail(-22, "TX decode failed");
+        }
+        return reply("\"" + BytesToHex(txid) + "\"");
+    }
+    if (method == "estimatesmartfee") {
+        uint64_t target = params.empty() ? 6 : std::max<uint64_t>(1, std::strtoull(params[0].c_str(), nullptr, 10));
+        return reply("{\"feerate\":" + std::to_string(SIM_FEE_RATE) + ",\"blocks\":" + std::to_string(target) + "}");
+    }
+    return fail(-32601, "Method not found");
+}
+
+// ========================================
+// Client
+// ========================================
+
+SimPeerClient::~SimPeerClient() {
+    Close();
+}
+
+Result<void> SimPeerClient::Connect(uint16_t port) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ >= 0) {
+        return Result<void>::Error("Already connected");
+    }
+    fd_ = ConnectLoopback(port);
+    if (fd_ < 0) {
+        return Result<void>::Error("Failed to connect: " + std::string(std::strerror(errno)));
+    }
+
+    std::vector<uint8_t> version;
+    PutLE64(&version, 0);
+    std::vector<uint8_t> frame = EncodeSimFrame("version", version);
+    if (!WriteAll(fd_, frame.data(), frame.size())) {
+        return Result<void>::Error("Failed to send version");
+    }
+
+    std::string command;
+    std::vector<uint8_t> payload;
+    while (ReadFrame(fd_, &command, &payload)) {
+        if (command == "verack") {
+            return Result<void>::Ok();
+        }
+    }
+    return Result<void>::Error("Handshake failed");
+}
+
+void SimPeerClient::Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+Result<std::vector<SimHeader>> SimPeerClient::GetHeaders(const std::vector<uint256>& locator, uint32_t max,
+                                                         uint64_t* start_height) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<uint8_t> request;
+    PutLE32(&request, static_cast<uint32_t>(locator.size()));
+    for (const auto& hash : locator) {
+        request.insert(request.end(), hash.begin(), hash.end());
+    }
+    PutLE32(&request, max);
+    std::vector<uint8_t> frame = EncodeSimFrame("getheaders", request);
+    if (fd_ < 0 || !WriteAll(fd_, frame.data(), frame.size())) {
+        return Result<std::vector<SimHeader>>::Error("Not connected");
+    }
+
+    std::string command;
+    std::vector<uint8_t> payload;
+    do {
+        if (!ReadFrame(fd_, &command, &payload)) {
+            return Result<std::vector<SimHeader>>::Error("Connection lost");
+        }
+    } while (command != "headers");
+
+    if (payload.size() < 12) {
+        return Result<std::vector<SimHeader>>::Error("Malformed headers message");
+    }
+    uint32_t count = GetLE32(payload.data() + 8);
+    if (payload.size() != 12 + static_cast<size_t>(count) * SIM_HEADER_SIZE) {
+        return Result<std::vector<SimHeader>>::Error("Malformed headers message");
+    }
+
+    *start_height = GetLE64(payload.data());
+    std::vector<SimHeader> headers;
+    headers.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        headers.push_back(SimHeader::Deserialize(payload.data() + 12 + i * SIM_HEADER_SIZE));
+    }
+    return Result<std::vector<SimHeader>>::Ok(std::move(headers));
+}
+
+Result<std::vector<std::vector<std::vector<uint8_t>>>> SimPeerClient::GetBlocks(const std::vector<uint256>& hashes) {
+    using BlockList = std::vector<std::vector<std::vector<uint8_t>>>;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<uint8_t> requests;
+    for (const auto& hash : hashes) {
+        std::vector<uint8_t> frame = EncodeSimFrame("getblock", std::vector<uint8_t>(hash.begin(), hash.end()));
+        requests.insert(requests.end(), frame.begin(), frame.end());
+    }
+    if (fd_ < 0 || !WriteAll(fd_, requests.data(), requests.size())) {
+        return Result<BlockList>::Error("Not connected");
+    }
+
+    // Responses come back in request order
+    BlockList blocks;
+    blocks.reserve(hashes.size());
+    std::string command;
+    std::vector<uint8_t> payload;
+    while (blocks.size() < hashes.size()) {
+        if (!ReadFrame(fd_, &command, &payload)) {
+            return Result<BlockList>::Error("Connection lost");
+        }
+        if (command == "notfound") {
+            return Result<BlockList>::Error("Block not found");
+        }
+        if (command != "block") {
+            continue;
+        }
+
+        if (payload.size() < SIM_HEADER_SIZE + 4 ||
+            SHA3::Hash(payload.data(), SIM_HEADER_SIZE) != hashes[blocks.size()]) {
+            return Result<BlockList>::Error("Unexpected block");
+        }
+        size_t pos = SIM_HEADER_SIZE;
+        uint32_t count = GetLE32(payload.data() + pos);
+        pos += 4;
+
+        std::vector<std::vector<uint8_t>> txs;
+        txs.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (payload.size() - pos < 4) {
+                return Result<BlockList>::Error("Malformed block");
+            }
+            uint32_t length = GetLE32(payload.data() + pos);
+            pos += 4;
+            if (payload.size() - pos < length) {
+                return Result<BlockList>::Error("Malformed block");
+            }
+            txs.emplace_back(payload.begin() + pos, payload.begin() + pos + length);
+            pos += length;
+        }
+        blocks.push_back(std::move(txs));
+    }
+    return Result<BlockList>::Ok(std::move(blocks));
+}
+
+Result<uint256> SimPeerClient::SendTransaction(const std::vector<uint8_t>& raw_tx) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<uint8_t> frame = EncodeSimFrame("tx", raw_tx);
+    if (fd_ < 0 || !WriteAll(fd_, frame.data(), frame.size())) {
+        return Result<uint256>::Error("Not connected");
+    }
+
+    std::string command;
+    std::vector<uint8_t> payload;
+    while (ReadFrame(fd_, &command, &payload)) {
+        if (command == "accepted" && payload.size() == 32) {
+            uint256 txid;
+            std::memcpy(txid.data(), payload.data(), 32);
+            return Result<uint256>::Ok(txid);
+        }
+        if (command == "reject") {
+            return Result<uint256>::Error("Rejected: " + std::string(payload.begin(), payload.end()));
+        }
+    }
+    return Result<uint256>::Error("Connection lost");
+}
+
+Result<std::string> SimRPCCall(uint16_t port, const std::string& method, const std::string& params_json) {
+    int fd = ConnectLoopback(port);
+    if (fd < 0) {
+        return Result<std::string>::Error("Failed to connect: " + std::string(std::strerror(errno)));
+    }
+
+    std::string body = "{\"jsonrpc\":\"1.0\",\"id\":1,\"method\":\"" + method + "\",\"params\":" + params_json + "}";
+    std::string request = "POST / HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Type: application/json\r\nContent-Length: " +
+                          std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+    if (!WriteAll(fd, reinterpret_cast<const uint8_t*>(request.data()), request.size())) {
+        ::close(fd);
+        return Result<std::string>::Error("Failed to send request");
+    }
+
+    // Read until the declared body length has arrived
+    std::string response;
+    char chunk[16384];
+    while (true) {
+        size_t header_end = response.find("\r\n\r\n");
+        if (header_end != std::string::npos) {
+            size_t field = response.find("Content-Length:");
+            size_t length = field == std::string::npos ? 0 : std::strtoull(response.c_str() + field + 15, nullptr, 10);
+            if (response.size() >= header_end + 4 + length) {
+                response = response.substr(header_end + 4, length);
+                break;
+            }
+        }
+        ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) {
+            ::close(fd);
+            return Result<std::string>::Error("Connection lost");
+        }
+        response.append(chunk, static_cast<size_t>(n));
+    }
+    ::close(fd);
+
+    std::string error = Member(response, "error");
+    if (!error.empty() && error != "null") {
+        return Result<std::string>::Error(Unquote(Member(error, "message")));
+    }
+    return Result<std::string>::Ok(Member(response, "result"));
+}
+
+}  // namespace bench
+}  // namespace intcoin
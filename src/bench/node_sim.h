@@ -0,0 +1,277 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Loopback node simulator for the SDK bookkeeping benches.
+//
+// NodeSimulator generates a synthetic header chain whose blocks carry
+// transactions paying a given set of wallet addresses, and serves it on
+// 127.0.0.1. Its P2P framing is its own, not the INTcoin wire protocol,
+// so the core SPV client cannot connect to it; only SimPeerClient, driven
+// by a bench standing in for the sync layer, speaks it. Timings against it
+// measure the SDK and loopback transfer, not the wallet's real sync or
+// relay. It speaks two protocols:
+//
+//   P2P: framed messages for header sync, block fetch and transaction
+//        relay (layout below)
+//   RPC: HTTP/1.1 JSON-RPC (getblockcount, getbestblockhash, getblockhash,
+//        getblockheader, sendrawtransaction, estimatesmartfee)
+//
+// Every response can be delayed by a fixed latency and paced to a
+// bandwidth limit; responses to pipelined requests overlap their latency
+// as they would on a real link. Reorgs are injected on demand or every N
+// mined blocks.
+//
+// P2P frame: magic (4, "INTS") | command (12, NUL-padded) | payload
+// length (4, LE) | checksum (first 4 bytes of SHA3-256 of the payload) |
+// payload. Messages:
+//
+//   version    best height (8)                 -> version, verack
+//   getheaders locator count (4) | hashes (32 each) | max (4)
+//                                               -> headers: start height (8) |
+//                                                  count (4) | headers (84 each)
+//   getblock   block hash (32)                  -> block: header (84) | tx count (4) |
+//                                                  (length (4) | raw tx)*
+//                                                  or notfound: block hash (32)
+//   tx         raw transaction                  -> accepted: txid (32)
+//                                                  or reject: reason
+//   ping       nonce (8)                        -> pong: nonce (8)
+//
+// Header: version (4) | prev hash (32) | tx commitment (32) | timestamp (8)
+// | bits (4) | nonce (4); its hash is SHA3-256 of those 84 bytes. There is
+// no proof of work, and the commitment is the SHA3 of the txids, not a
+// merkle root.
+
+#ifndef INTCOIN_BENCH_NODE_SIM_H
+#define INTCOIN_BENCH_NODE_SIM_H
+
+#include <intcoin/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace intcoin {
+namespace bench {
+
+/// Size of a serialized simulator header
+constexpr size_t SIM_HEADER_SIZE = 84;
+
+/// Simulator configuration
+struct NodeSimConfig {
+    /// Blocks generated on construction (including genesis)
+    uint64_t chain_length = 10000;
+
+    /// Addresses wallet transactions pay to
+    std::vector<std::string> wallet_addresses;
+
+    /// Share of blocks with transactions for the wallet
+    double wallet_block_rate = 0.05;
+
+    /// Most wallet transactions in one block
+    size_t max_wallet_txs_per_block = 3;
+
+    /// Delay added to every response
+    std::chrono::microseconds latency{0};
+
+    /// Response bandwidth per connection in bytes per second (0 = unlimited)
+    uint64_t bandwidth_bytes_per_sec = 0;
+
+    /// Reorg every N mined blocks (0 = only when asked)
+    uint32_t reorg_interval = 0;
+
+    /// Blocks replaced by an injected reorg
+    uint32_t reorg_depth = 3;
+
+    /// Seed for amounts, timestamps and which blocks pay the wallet
+    uint64_t seed = 1;
+
+    /// Ports to listen on (0 = any free port)
+    uint16_t p2p_port = 0;
+    uint16_t rpc_port = 0;
+};
+
+/// Decoded simulator header
+struct SimHeader {
+    uint32_t version = 1;
+    uint256 prev_hash{};
+    uint256 commitment{};
+    uint64_t timestamp = 0;
+    uint32_t bits = 0;
+    uint32_t nonce = 0;
+
+    std::vector<uint8_t> Serialize() const;
+    static SimHeader Deserialize(const uint8_t* data);
+    uint256 GetHash() const;
+};
+
+/// Block as served to peers
+struct SimBlock {
+    uint64_t height = 0;
+    SimHeader header;
+    uint256 hash{};
+    std::vector<std::vector<uint8_t>> txs;  // Serialized wallet transactions
+};
+
+/// Simulator counters
+struct NodeSimStats {
+    uint64_t p2p_connections = 0;
+    uint64_t rpc_requests = 0;
+    uint64_t headers_served = 0;
+    uint64_t blocks_served = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t txs_accepted = 0;
+    uint64_t reorgs = 0;
+};
+
+class NodeSimulator {
+public:
+    explicit NodeSimulator(NodeSimConfig config);
+    ~NodeSimulator();
+
+    NodeSimulator(const NodeSimulator&) = delete;
+    NodeSimulator& operator=(const NodeSimulator&) = delete;
+
+    /// Listen on loopback and start serving
+    Result<void> Start();
+
+    /// Stop serving and close every connection
+    void Stop();
+
+    uint16_t GetP2PPort() const { return p2p_port_; }
+    uint16_t GetRPCPort() const { return rpc_port_; }
+
+    // Chain control
+
+    /// Extend the chain, injecting configured reorgs on the way
+    void MineBlocks(size_t count);
+
+    /// Replace the top depth blocks with a different branch one block longer
+    void Reorg(uint32_t depth);
+
+    uint64_t GetHeight() const;
+    uint256 GetTipHash() const;
+
+    /// Block on the active chain
+    /// @return Null if height is past the tip
+    std::shared_ptr<const SimBlock> GetBlock(uint64_t height) const;
+
+    /// Change response shaping while running
+    void SetLatency(std::chrono::microseconds latency);
+    void SetBandwidth(uint64_t bytes_per_sec);
+
+    /// Wait until a transaction has been relayed to the simulator
+    /// @return False on timeout
+    bool WaitForTransaction(const uint256& txid, std::chrono::milliseconds timeout);
+
+    NodeSimStats GetStats() const;
+
+private:
+    struct Connection;
+
+    NodeSimConfig config_;
+
+    mutable std::mutex chain_mutex_;
+    std::vector<std::shared_ptr<const SimBlock>> chain_;  // Active chain by height
+    std::unordered_map<uint64_t, std::shared_ptr<const SimBlock>> blocks_;  // Every block, by hash prefix
+    uint64_t branch_ = 0;        // Bumped per reorg so replacement blocks differ
+    uint64_t mined_since_reorg_ = 0;
+
+    std::atomic<int64_t> latency_us_{0};
+    std::atomic<uint64_t> bandwidth_{0};
+
+    mutable std::mutex tx_mutex_;
+    std::condition_variable tx_cv_;
+    std::map<uint256, std::vector<uint8_t>> mempool_;
+
+    mutable std::mutex stats_mutex_;
+    NodeSimStats stats_;
+
+    std::atomic<bool> running_{false};
+    int p2p_listener_ = -1;
+    int rpc_listener_ = -1;
+    uint16_t p2p_port_ = 0;
+    uint16_t rpc_port_ = 0;
+    std::thread p2p_accept_thread_;
+    std::thread rpc_accept_thread_;
+
+    std::mutex connections_mutex_;
+    std::vector<std::shared_ptr<Connection>> connections_;
+
+    std::shared_ptr<const SimBlock> MakeBlock(uint64_t height, const uint256& prev_hash);
+    void AppendBlockLocked();
+    void ReorgLocked(uint32_t depth);
+
+    void AcceptLoop(int listener, bool rpc);
+    void ServeP2P(std::shared_ptr<Connection> connection);
+    void ServeRPC(std::shared_ptr<Connection> connection);
+    void WriterLoop(std::shared_ptr<Connection> connection);
+
+    /// Queue a response to go out after the configured latency
+    void Respond(Connection& connection, std::vector<uint8_t> bytes);
+
+    std::vector<uint8_t> HandleGetHeaders(const std::vector<uint8_t>& payload);
+    std::vector<uint8_t> HandleGetBlock(const std::vector<uint8_t>& payload);
+    std::vector<uint8_t> HandleTx(const std::vector<uint8_t>& payload, std::string* error);
+    std::string HandleRPC(const std::string& body);
+};
+
+// ========================================
+// Client
+// ========================================
+
+/// Client side of the simulator P2P protocol
+class SimPeerClient {
+public:
+    SimPeerClient() = default;
+    ~SimPeerClient();
+
+    SimPeerClient(const SimPeerClient&) = delete;
+    SimPeerClient& operator=(const SimPeerClient&) = delete;
+
+    /// Connect to 127.0.0.1 and complete the version handshake
+    Result<void> Connect(uint16_t port);
+
+    void Close();
+
+    /// Headers following the first locator hash found on the server's chain
+    /// @param locator Hashes from the client's tip backwards
+    /// @param max Most headers wanted
+    /// @param start_height Set to the height of the first header returned
+    Result<std::vector<SimHeader>> GetHeaders(const std::vector<uint256>& locator, uint32_t max,
+                                              uint64_t* start_height);
+
+    /// Fetch blocks, sending every request before reading any response
+    /// @return Serialized transactions of each block, in request order
+    Result<std::vector<std::vector<std::vector<uint8_t>>>> GetBlocks(const std::vector<uint256>& hashes);
+
+    /// Relay a transaction and wait for the simulator to accept it
+    Result<uint256> SendTransaction(const std::vector<uint8_t>& raw_tx);
+
+private:
+    int fd_ = -1;
+    std::mutex mutex_;
+};
+
+/// Build a P2P frame
+std::vector<uint8_t> EncodeSimFrame(const std::string& command, const std::vector<uint8_t>& payload);
+
+/// Make one JSON-RPC call to the simulator over a fresh connection
+/// @param port RPC port
+/// @param method Method name
+/// @param params_json Parameters as a JSON array
+/// @return The "result" member as JSON text, or the RPC error message
+Result<std::string> SimRPCCall(uint16_t port, const std::string& method, const std::string& params_json = "[]");
+
+}  // namespace bench
+}  // namespace intcoin
+
+#endif  // INTCOIN_BENCH_NODE_SIM_H
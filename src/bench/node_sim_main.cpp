@@ -0,0 +1,125 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Standalone loopback node simulator, serving a chain with known shape to
+// scripts and tools that speak its framing (see node_sim.h). The SDK and
+// the C API cannot sync from it, since the SPV client speaks the real P2P
+// protocol. Prints its ports as one JSON line, then serves until
+// interrupted.
+//
+// Usage: node_sim [--blocks=10000] [--address=<bech32>]... [--latency-ms=0]
+//                 [--bandwidth=<bytes/s>] [--mine-interval-ms=0]
+//                 [--reorg-interval=0] [--reorg-depth=3] [--seed=1]
+//                 [--p2p-port=0] [--rpc-port=0]
+
+#include "bench.h"
+#include "node_sim.h"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace {
+
+volatile std::sig_atomic_t g_stop = 0;
+
+void HandleSignal(int) {
+    g_stop = 1;
+}
+
+bool ParseOptions(int argc, char** argv, intcoin::bench::NodeSimConfig* config, uint64_t* mine_interval_ms) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) {
+            return false;
+        }
+        std::string name = arg.substr(0, eq);
+        std::string value = arg.substr(eq + 1);
+        uint64_t number = std::strtoull(value.c_str(), nullptr, 10);
+
+        if (name == "--blocks") {
+            config->chain_length = number;
+        } else if (name == "--address") {
+            config->wallet_addresses.push_back(value);
+        } else if (name == "--latency-ms") {
+            config->latency = std::chrono::milliseconds(number);
+        } else if (name == "--bandwidth") {
+            config->bandwidth_bytes_per_sec = number;
+        } else if (name == "--mine-interval-ms") {
+            *mine_interval_ms = number;
+        } else if (name == "--reorg-interval") {
+            config->reorg_interval = static_cast<uint32_t>(number);
+        } else if (name == "--reorg-depth") {
+            config->reorg_depth = static_cast<uint32_t>(number);
+        } else if (name == "--seed") {
+            config->seed = number;
+        } else if (name == "--p2p-port") {
+            config->p2p_port = static_cast<uint16_t>(number);
+        } else if (name == "--rpc-port") {
+            config->rpc_port = static_cast<uint16_t>(number);
+        } else {
+            return false;
+        }
+    }
+    return config->chain_length > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    intcoin::bench::NodeSimConfig config;
+    uint64_t mine_interval_ms = 0;
+    if (!ParseOptions(argc, argv, &config, &mine_interval_ms)) {
+        std::fprintf(stderr,
+                     "usage: %s [--blocks=N] [--address=ADDR]... [--latency-ms=N] [--bandwidth=N]\n"
+                     "          [--mine-interval-ms=N] [--reorg-interval=N] [--reorg-depth=N] [--seed=N]\n"
+                     "          [--p2p-port=N] [--rpc-port=N]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    intcoin::bench::NodeSimulator sim(config);
+    auto start_result = sim.Start();
+    if (start_result.IsError()) {
+        std::fprintf(stderr, "%s\n", start_result.error.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+
+    intcoin::bench::Report("node_sim")
+        .Add("p2p_port", static_cast<uint64_t>(sim.GetP2PPort()))
+        .Add("rpc_port", static_cast<uint64_t>(sim.GetRPCPort()))
+        .Add("height", sim.GetHeight())
+        .Print();
+    std::fflush(stdout);
+
+    auto next_block = intcoin::bench::Clock::now() + std::chrono::milliseconds(mine_interval_ms);
+    while (!g_stop) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (mine_interval_ms > 0 && intcoin::bench::Clock::now() >= next_block) {
+            sim.MineBlocks(1);
+            next_block += std::chrono::milliseconds(mine_interval_ms);
+        }
+    }
+
+    sim.Stop();
+
+    intcoin::bench::NodeSimStats stats = sim.GetStats();
+    intcoin::bench::Report("node_sim")
+        .Add("height", sim.GetHeight())
+        .Add("p2p_connections", stats.p2p_connections)
+        .Add("rpc_requests", stats.rpc_requests)
+        .Add("headers_served", stats.headers_served)
+        .Add("blocks_served", stats.blocks_served)
+        .Add("bytes_sent", stats.bytes_sent)
+        .Add("txs_accepted", stats.txs_accepted)
+        .Add("reorgs", stats.reorgs)
+        .Print();
+    return 0;
+}
@@ -0,0 +1,189 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Payment URI throughput: builds and parses batches of QR payloads the
+// way a merchant terminal or a scanning camera loop would, and compares
+// the buffer-based kernels with the ostringstream/substr approach they
+// replaced. Heap allocations per operation are counted by replacing
+// global operator new.
+
+#include "bench.h"
+
+#include <intcoin/mobile_payment_uri.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+std::atomic<uint64_t> g_allocations{0};
+
+}  // namespace
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+constexpr size_t URI_COUNT = 100000;
+
+struct Request {
+    std::string address;
+    uint64_t amount_ints;
+    std::string label;
+    std::string message;
+};
+
+std::vector<Request> MakeRequests() {
+    std::mt19937_64 rng(7);
+    std::vector<Request> requests(URI_COUNT);
+    for (size_t i = 0; i < URI_COUNT; ++i) {
+        requests[i].address = "int1qw508d6qejxtdg4y5r3zarvary0c5xw7k" + std::to_string(100000 + i);
+        requests[i].amount_ints = rng() % 50000000000ULL;
+        requests[i].label = "Invoice " + std::to_string(i);
+        requests[i].message = (i % 4 == 0) ? "Table 12, thanks!" : "";
+    }
+    return requests;
+}
+
+// Stream-based builder and substr-based parser, as shipped before the
+// buffer kernels, for comparison
+
+std::string LegacyBuild(const Request& request) {
+    std::ostringstream uri;
+    uri << "intcoin:" << request.address;
+    bool has_params = false;
+    if (request.amount_ints > 0) {
+        std::ostringstream amount;
+        amount << request.amount_ints / 1000000 << "." << std::setfill('0') << std::setw(6)
+               << request.amount_ints % 1000000;
+        uri << "?amount=" << amount.str();
+        has_params = true;
+    }
+    if (!request.label.empty()) {
+        uri << (has_params ? "&" : "?") << "label=" << request.label;
+        has_params = true;
+    }
+    if (!request.message.empty()) {
+        uri << (has_params ? "&" : "?") << "message=" << request.message;
+    }
+    return uri.str();
+}
+
+size_t LegacyParse(const std::string& uri) {
+    size_t fields = 0;
+    size_t param_start = uri.find('?');
+    std::string address = uri.substr(8, param_start - 8);
+    fields += address.size();
+    if (param_start != std::string::npos) {
+        std::string params = uri.substr(param_start + 1);
+        size_t pos = 0;
+        while (pos < params.size()) {
+            size_t amp_pos = params.find('&', pos);
+            std::string param = (amp_pos == std::string::npos) ? params.substr(pos)
+                                                               : params.substr(pos, amp_pos - pos);
+            size_t eq_pos = param.find('=');
+            if (eq_pos != std::string::npos) {
+                std::string key = param.substr(0, eq_pos);
+                std::string value = param.substr(eq_pos + 1);
+                fields += key.size() + value.size();
+            }
+            if (amp_pos == std::string::npos) break;
+            pos = amp_pos + 1;
+        }
+    }
+    return fields;
+}
+
+void ReportRun(const char* op, const char* impl, uint64_t elapsed_ns, uint64_t allocations) {
+    bench::Report("payment_uri")
+        .Add("op", op)
+        .Add("impl", impl)
+        .Add("uris", static_cast<uint64_t>(URI_COUNT))
+        .Add("ns_per_uri", static_cast<double>(elapsed_ns) / URI_COUNT)
+        .Add("allocs_per_uri", static_cast<double>(allocations) / URI_COUNT)
+        .Print();
+}
+
+}  // namespace
+
+int main() {
+    const std::vector<Request> requests = MakeRequests();
+
+    // Build
+    std::vector<std::string> legacy_uris;
+    legacy_uris.reserve(URI_COUNT);
+    uint64_t allocs = g_allocations.load();
+    auto start = bench::Clock::now();
+    for (const auto& request : requests) {
+        legacy_uris.push_back(LegacyBuild(request));
+    }
+    ReportRun("build", "ostringstream", bench::ElapsedNs(start), g_allocations.load() - allocs);
+
+    std::vector<char> arena(URI_COUNT * 256);
+    std::vector<std::string_view> uris(URI_COUNT);
+    allocs = g_allocations.load();
+    start = bench::Clock::now();
+    char* out = arena.data();
+    for (size_t i = 0; i < URI_COUNT; ++i) {
+        const auto& request = requests[i];
+        auto result = BuildPaymentURI(out, 256, request.address, request.amount_ints,
+                                      request.label, request.message);
+        if (result.IsError()) {
+            std::fprintf(stderr, "build failed: %s\n", result.error.c_str());
+            return 1;
+        }
+        uris[i] = std::string_view(out, result.GetValue());
+        out += 256;
+    }
+    ReportRun("build", "buffer", bench::ElapsedNs(start), g_allocations.load() - allocs);
+
+    // Parse
+    volatile size_t sink = 0;
+    allocs = g_allocations.load();
+    start = bench::Clock::now();
+    for (const auto& uri : legacy_uris) {
+        sink = sink + LegacyParse(uri);
+    }
+    ReportRun("parse", "substr", bench::ElapsedNs(start), g_allocations.load() - allocs);
+
+    char scratch[256];
+    size_t mismatches = 0;
+    allocs = g_allocations.load();
+    start = bench::Clock::now();
+    for (size_t i = 0; i < URI_COUNT; ++i) {
+        auto result = ParsePaymentURI(uris[i], scratch, sizeof(scratch));
+        if (result.IsError() || result.GetValue().amount_ints != requests[i].amount_ints) {
+            ++mismatches;
+        }
+    }
+    ReportRun("parse", "string_view", bench::ElapsedNs(start), g_allocations.load() - allocs);
+
+    if (mismatches > 0) {
+        std::fprintf(stderr, "%zu URIs did not round-trip\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
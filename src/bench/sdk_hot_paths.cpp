@@ -0,0 +1,246 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// SDK and RPC hot paths: times the calls a wallet screen makes on every
+// refresh (balance, UTXOs, history pages, fee calculation, bloom filter
+// rebuild) against wallets of 1k, 100k and 1M history entries, plus the
+// size-independent helpers (payment URIs, amount formatting, address
+// validation) and their C API wrappers.
+//
+// Link with mock_core.cpp in place of the core's spv and wallet objects;
+// the wallet and chain are then served from memory.
+//
+// Usage: sdk_hot_paths [--sizes=1000,100000,1000000] [--min-time-ms=200]
+
+#include "bench.h"
+#include "mock_core.h"
+
+#include <intcoin/mobile_sdk.h>
+#include <intcoin/mobile_tx_builder.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+const std::vector<size_t> DEFAULT_SIZES = {1000, 100000, 1000000};
+
+/// Rows a history screen shows per page
+constexpr uint32_t PAGE_SIZE = 50;
+
+struct Options {
+    std::vector<size_t> sizes = DEFAULT_SIZES;
+    uint64_t min_time_ns = 200000000;
+};
+
+bool ParseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--sizes=", 0) == 0) {
+            options->sizes.clear();
+            const char* p = arg.c_str() + std::strlen("--sizes=");
+            while (*p) {
+                char* end = nullptr;
+                unsigned long long size = std::strtoull(p, &end, 10);
+                if (end == p || size == 0) {
+                    return false;
+                }
+                options->sizes.push_back(static_cast<size_t>(size));
+                p = *end == ',' ? end + 1 : end;
+            }
+        } else if (arg.rfind("--min-time-ms=", 0) == 0) {
+            options->min_time_ns = std::strtoull(arg.c_str() + std::strlen("--min-time-ms="), nullptr, 10) * 1000000;
+        } else {
+            return false;
+        }
+    }
+    return !options->sizes.empty();
+}
+
+/// Keeps results alive so calls are not optimised away
+volatile uint64_t g_sink = 0;
+
+template <typename Fn>
+void Run(const Options& options, const char* op, size_t history_entries, Fn&& fn) {
+    uint64_t calls = 0;
+    double ns = bench::TimePerCall(fn, options.min_time_ns, &calls);
+    bench::Report("sdk_hot_paths")
+        .Add("op", op)
+        .Add("history_entries", static_cast<uint64_t>(history_entries))
+        .Add("calls", calls)
+        .Add("ns_per_op", ns)
+        .Print();
+}
+
+void RunHelpers(const Options& options) {
+    const std::string address = bench::MockAddress(0);
+    const std::string uri = MobileSDK::GeneratePaymentURI(address, 1234567, "Coffee & cake", "Table 4");
+
+    Run(options, "ValidateAddress", 0, [&] {
+        g_sink = g_sink + (MobileSDK::ValidateAddress(address) ? 1 : 0);
+    });
+    Run(options, "FormatINTS", 0, [&] {
+        g_sink = g_sink + MobileSDK::FormatINTS(g_sink * 7919 + 1234567).size();
+    });
+    Run(options, "ParsePaymentURI", 0, [&] {
+        g_sink = g_sink + MobileSDK::ParsePaymentURI(uri).GetValue().amount_ints;
+    });
+    Run(options, "GeneratePaymentURI", 0, [&] {
+        g_sink = g_sink + MobileSDK::GeneratePaymentURI(address, 1234567, "Coffee & cake", "Table 4").size();
+    });
+
+    char out[512];
+    Run(options, "intcoin_sdk_validate_address", 0, [&] {
+        g_sink = g_sink + static_cast<uint64_t>(intcoin_sdk_validate_address(address.c_str()));
+    });
+    Run(options, "intcoin_sdk_format_ints", 0, [&] {
+        intcoin_sdk_format_ints(g_sink * 7919 + 1234567, out);
+        g_sink = g_sink + static_cast<uint64_t>(out[0]);
+    });
+    Run(options, "intcoin_sdk_generate_payment_uri", 0, [&] {
+        intcoin_sdk_generate_payment_uri(address.c_str(), 1234567, "Coffee & cake", "Table 4", out);
+        g_sink = g_sink + static_cast<uint64_t>(out[0]);
+    });
+}
+
+/// Two inputs (the oldest coins, so lookups walk the whole UTXO set),
+/// two payments and change
+Transaction MakeFeeTransaction() {
+    const auto& utxos = bench::MockWallet().utxos;
+    std::vector<TxInputCoin> inputs;
+    for (size_t i = utxos.size() - std::min<size_t>(2, utxos.size()); i < utxos.size(); ++i) {
+        inputs.push_back({utxos[i].outpoint.tx_hash, utxos[i].outpoint.index, utxos[i].value});
+    }
+    uint64_t total = 0;
+    for (const auto& input : inputs) {
+        total += input.amount;
+    }
+
+    std::vector<TxRecipient> recipients = {{bench::MockAddress(1), total / 4},
+                                           {bench::MockAddress(2), total / 4}};
+    auto tx_result = BuildUnsignedTransaction(inputs, recipients, bench::MockAddress(3),
+                                              total - 2 * (total / 4) - 10000);
+    return tx_result.GetValue();
+}
+
+void RunWallet(const Options& options, size_t history_entries, const std::string& dir) {
+    bench::PopulateMockWallet(history_entries);
+
+    // RPC handler on its own, as a server deployment uses it
+    auto spv_client = std::make_shared<SPVClient>(nullptr);
+    auto wallet = std::make_shared<wallet::Wallet>(wallet::WalletConfig());
+    MobileRPC rpc(spv_client, wallet);
+
+    Run(options, "rpc.GetBalance", history_entries, [&] {
+        BalanceRequest request;
+        request.min_confirmations = 1;
+        g_sink = g_sink + rpc.GetBalance(request).GetValue().total_balance;
+    });
+    Run(options, "rpc.GetUTXOs", history_entries, [&] {
+        UTXORequest request;
+        request.min_confirmations = 1;
+        g_sink = g_sink + rpc.GetUTXOs(request).GetValue().utxos.size();
+    });
+    Run(options, "rpc.GetHistory", history_entries, [&] {
+        HistoryRequest request;
+        request.page_size = PAGE_SIZE;
+        request.page = 0;
+        g_sink = g_sink + rpc.GetHistory(request).GetValue().entries.size();
+    });
+
+    const Transaction fee_tx = MakeFeeTransaction();
+    Run(options, "rpc.CalculateTransactionFee", history_entries, [&] {
+        g_sink = g_sink + rpc.CalculateTransactionFee(fee_tx);
+    });
+
+    // Full SDK, with its address index and caches
+    SDKConfig config;
+    config.wallet_path = dir + "/sdk_" + std::to_string(history_entries);
+    std::filesystem::create_directories(config.wallet_path);
+    {
+        MobileSDK sdk(config);
+        if (sdk.OpenWallet("bench").IsError()) {
+            std::fprintf(stderr, "failed to open mock wallet\n");
+            std::exit(1);
+        }
+
+        // First call builds the address index; report it apart from steady state
+        auto start = bench::Clock::now();
+        g_sink = g_sink + sdk.GetBalance().GetValue().total_balance;
+        bench::Report("sdk_hot_paths")
+            .Add("op", "sdk.BuildAddressIndex")
+            .Add("history_entries", static_cast<uint64_t>(history_entries))
+            .Add("calls", static_cast<uint64_t>(1))
+            .Add("ns_per_op", static_cast<double>(bench::ElapsedNs(start)))
+            .Print();
+
+        Run(options, "sdk.GetBalance", history_entries, [&] {
+            g_sink = g_sink + sdk.GetBalance().GetValue().total_balance;
+        });
+        Run(options, "sdk.GetUTXOs", history_entries, [&] {
+            g_sink = g_sink + sdk.GetUTXOs(1).GetValue().utxos.size();
+        });
+        Run(options, "sdk.GetTransactionHistory.first_page", history_entries, [&] {
+            g_sink = g_sink + sdk.GetTransactionHistory(PAGE_SIZE, 0).GetValue().entries.size();
+        });
+        Run(options, "sdk.GetTransactionHistory.middle_page", history_entries, [&] {
+            uint32_t offset = static_cast<uint32_t>(history_entries / 2 / PAGE_SIZE * PAGE_SIZE);
+            g_sink = g_sink + sdk.GetTransactionHistory(PAGE_SIZE, offset).GetValue().entries.size();
+        });
+
+        // StartSync rebuilds the bloom filter over every wallet address
+        Run(options, "sdk.UpdateBloomFilter", history_entries, [&] {
+            g_sink = g_sink + (sdk.StartSync().IsOk() ? 1 : 0);
+            sdk.StopSync();
+        });
+
+        sdk.CloseWallet();
+    }
+
+    // C API wrappers around the same calls
+    std::string c_dir = dir + "/c_api_" + std::to_string(history_entries);
+    std::filesystem::create_directories(c_dir);
+    intcoin_sdk_t handle = intcoin_sdk_create("mainnet", c_dir.c_str(), "http://localhost:2210");
+    if (!handle || intcoin_sdk_open_wallet(handle, "bench") != 0) {
+        std::fprintf(stderr, "failed to open mock wallet through the C API\n");
+        std::exit(1);
+    }
+    Run(options, "intcoin_sdk_get_balance", history_entries, [&] {
+        uint64_t confirmed = 0;
+        uint64_t unconfirmed = 0;
+        intcoin_sdk_get_balance(handle, &confirmed, &unconfirmed);
+        g_sink = g_sink + confirmed;
+    });
+    intcoin_sdk_close_wallet(handle);
+    intcoin_sdk_destroy(handle);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, &options)) {
+        std::fprintf(stderr, "usage: %s [--sizes=1000,100000,1000000] [--min-time-ms=200]\n", argv[0]);
+        return 2;
+    }
+
+    auto dir = std::filesystem::temp_directory_path() / ("intcoin_bench_" + std::to_string(bench::Clock::now().time_since_epoch().count()));
+    std::filesystem::create_directories(dir);
+
+    RunHelpers(options);
+    for (size_t size : options.sizes) {
+        RunWallet(options, size, dir.string());
+    }
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
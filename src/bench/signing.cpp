@@ -0,0 +1,132 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Batch signing scaling: signs batches of 4, 16 and 64 transactions on
+// 1..N lanes and reports wall time and speed-up over a single lane.
+//
+// The wallet signer is stood in for by a SHA3 chain per input sized to
+// roughly one Dilithium5 signature on a mid-range phone core, so the
+// numbers show how well the pool spreads work rather than the speed of a
+// particular key backend.
+
+#include "bench.h"
+
+#include <intcoin/crypto.h>
+#include <intcoin/mobile_signing.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+constexpr size_t BATCH_SIZES[] = {4, 16, 64};
+
+/// Inputs per transaction
+constexpr size_t INPUTS_PER_TX = 5;
+
+/// SHA3 rounds per stand-in signature
+constexpr size_t SIGN_ROUNDS = 2000;
+
+/// Dilithium5 signature and public key sizes
+constexpr size_t SIGNATURE_SIZE = 4595;
+constexpr size_t PUBLIC_KEY_SIZE = 2592;
+
+Transaction MakeTransaction(size_t batch_index, size_t num_inputs) {
+    Transaction tx;
+    tx.version = 1;
+    tx.locktime = 0;
+    for (size_t i = 0; i < num_inputs; ++i) {
+        TxIn input{};
+        uint64_t id = batch_index * num_inputs + i + 1;
+        std::memcpy(input.prev_tx_hash.data(), &id, sizeof(id));
+        input.prev_tx_index = static_cast<uint32_t>(i % 3);
+        input.sequence = 0xFFFFFFFF;
+        tx.inputs.push_back(input);
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        TxOut output{};
+        output.value = 1000000 * (i + 1);
+        output.script_pubkey.bytes.assign(34, static_cast<uint8_t>(i));
+        tx.outputs.push_back(output);
+    }
+    return tx;
+}
+
+Result<Transaction> StandInSign(const Transaction& tx) {
+    Transaction signed_tx = tx;
+    for (auto& input : signed_tx.inputs) {
+        uint256 state = input.prev_tx_hash;
+        for (size_t round = 0; round < SIGN_ROUNDS; ++round) {
+            state = SHA3::Hash(state.data(), state.size());
+        }
+        input.signature.resize(SIGNATURE_SIZE);
+        for (size_t i = 0; i < input.signature.size(); ++i) {
+            input.signature[i] = state[i % state.size()];
+        }
+        input.public_key.assign(PUBLIC_KEY_SIZE, 0x42);
+    }
+    return Result<Transaction>::Ok(signed_tx);
+}
+
+}  // namespace
+
+int main() {
+    // Powers of two up to the core count, then the core count itself
+    const size_t max_lanes = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> lane_counts;
+    for (size_t lanes = 1; lanes < max_lanes; lanes *= 2) {
+        lane_counts.push_back(lanes);
+    }
+    lane_counts.push_back(max_lanes);
+
+    for (size_t batch_size : BATCH_SIZES) {
+        std::vector<Transaction> txs;
+        for (size_t i = 0; i < batch_size; ++i) {
+            txs.push_back(MakeTransaction(i, INPUTS_PER_TX));
+        }
+
+        uint64_t single_lane_ns = 0;
+        std::vector<uint8_t> reference;
+
+        for (size_t lanes : lane_counts) {
+            WorkerPool pool(lanes - 1);
+
+            auto start = bench::Clock::now();
+            auto result = SignTransactions(txs, StandInSign, &pool);
+            uint64_t elapsed = bench::ElapsedNs(start);
+
+            if (result.IsError()) {
+                std::fprintf(stderr, "signing failed: %s\n", result.error.c_str());
+                return 1;
+            }
+
+            // Output must not depend on lane count
+            std::vector<uint8_t> signatures;
+            for (const auto& tx : result.GetValue()) {
+                for (const auto& input : tx.inputs) {
+                    signatures.insert(signatures.end(), input.signature.begin(), input.signature.end());
+                }
+            }
+            if (lanes == 1) {
+                single_lane_ns = elapsed;
+                reference = signatures;
+            }
+
+            bench::Report("signing")
+                .Add("transactions", static_cast<uint64_t>(batch_size))
+                .Add("inputs", static_cast<uint64_t>(batch_size * INPUTS_PER_TX))
+                .Add("lanes", static_cast<uint64_t>(lanes))
+                .Add("wall_ms", elapsed / 1e6)
+                .Add("per_tx_us", elapsed / 1e3 / batch_size)
+                .Add("speedup", static_cast<double>(single_lane_ns) / elapsed)
+                .Add("deterministic", signatures == reference ? "yes" : "no")
+                .Print();
+        }
+    }
+    return 0;
+}
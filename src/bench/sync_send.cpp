@@ -0,0 +1,432 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// SDK bookkeeping under a simulated sync and send: this bench plays the
+// sync layer itself against a NodeSimulator on loopback, and measures
+//
+//   sync  blocks per second from genesis to tip (headers, then block
+//         fetches pipelined BLOCK_WINDOW at a time, each block applied with
+//         NotifyBlockConnected), at several latencies and bandwidth limits
+//   reorg time to catch up after each injected reorg, with the blocks
+//         undone through NotifyBlockDisconnected
+//   send  time from SendRawTransaction until the simulator holds the
+//         transaction, through the SDK broadcast queue, and the same for
+//         sendrawtransaction over the simulator's RPC port
+//
+// These are not sync or relay figures for the wallet. The simulator
+// speaks its own framing, not the INTcoin P2P protocol, and the SPV
+// client is the in-memory mock, so nothing here exercises the core's
+// header sync, block download or peer handling. What is timed is the SDK
+// side: tip publication, address index, confirmation tracking and the
+// broadcast queue, plus loopback transfer. Every report carries scope
+// "sdk_bookkeeping" to say so.
+//
+// The simulator sends only transactions paying the wallet, standing in for
+// a peer that applies the wallet's bloom filter. Link with mock_core.cpp;
+// broadcasts reach the simulator through SetMockBroadcastHandler.
+//
+// Usage: sync_send [--blocks=10000] [--sends=200]
+
+#include "bench.h"
+#include "mock_core.h"
+#include "node_sim.h"
+
+#include <intcoin/mobile_sdk.h>
+#include <intcoin/mobile_tx_builder.h>
+#include <intcoin/transaction.h>
+#include <intcoin/util.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+/// Blocks requested before reading any response
+constexpr size_t BLOCK_WINDOW = 256;
+
+/// Headers asked for per getheaders
+constexpr uint32_t HEADERS_PER_REQUEST = 2000;
+
+/// Wallet addresses the simulated chain pays
+constexpr size_t WALLET_ADDRESSES = 20;
+
+struct Options {
+    uint64_t blocks = 10000;
+    size_t sends = 200;
+};
+
+bool ParseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--blocks=", 0) == 0) {
+            options->blocks = std::strtoull(arg.c_str() + std::strlen("--blocks="), nullptr, 10);
+        } else if (arg.rfind("--sends=", 0) == 0) {
+            options->sends = std::strtoull(arg.c_str() + std::strlen("--sends="), nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return options->blocks > 1 && options->sends > 0;
+}
+
+struct LinkProfile {
+    const char* name;
+    uint32_t latency_ms;
+    uint64_t bandwidth;  // Bytes per second, 0 = unlimited
+};
+
+const LinkProfile SYNC_PROFILES[] = {
+    {"loopback", 0, 0},
+    {"wifi", 20, 0},
+    {"mobile", 100, 0},
+    {"wifi_1mbps", 20, 125000},
+    {"mobile_256kbps", 100, 32000},
+};
+
+const LinkProfile SEND_PROFILES[] = {
+    {"loopback", 0, 0},
+    {"wifi", 20, 0},
+    {"mobile", 100, 0},
+};
+
+[[noreturn]] void Fail(const std::string& what, const std::string& error) {
+    std::fprintf(stderr, "%s: %s\n", what.c_str(), error.c_str());
+    std::exit(1);
+}
+
+/// Local view of the best chain, as the sync layer keeps it
+struct SyncState {
+    std::vector<uint256> hashes;  // By height
+    uint64_t blocks_connected = 0;
+    uint64_t blocks_disconnected = 0;
+    uint64_t txs_matched = 0;
+};
+
+/// Tip, then back one at a time for ten blocks, then doubling, then genesis
+std::vector<uint256> Locator(const std::vector<uint256>& hashes) {
+    std::vector<uint256> locator;
+    if (hashes.empty()) {
+        return locator;
+    }
+    uint64_t step = 1;
+    for (uint64_t height = hashes.size() - 1;; height -= step) {
+        locator.push_back(hashes[height]);
+        if (locator.size() >= 10) step *= 2;
+        if (height < step) break;
+    }
+    if (locator.back() != hashes[0]) {
+        locator.push_back(hashes[0]);
+    }
+    return locator;
+}
+
+/// Sync the SDK to the peer's tip
+void SyncToTip(bench::SimPeerClient& peer, MobileSDK& sdk, SyncState* state) {
+    while (true) {
+        uint64_t start = 0;
+        auto headers_result = peer.GetHeaders(Locator(state->hashes), HEADERS_PER_REQUEST, &start);
+        if (headers_result.IsError()) {
+            Fail("getheaders", headers_result.error);
+        }
+        const auto& headers = headers_result.GetValue();
+        if (headers.empty()) {
+            return;
+        }
+
+        // Headers start after the fork point; undo everything above it
+        while (state->hashes.size() > start) {
+            sdk.NotifyBlockDisconnected(state->hashes.size() - 1, state->hashes.back());
+            state->hashes.pop_back();
+            ++state->blocks_disconnected;
+        }
+
+        std::vector<uint256> hashes;
+        hashes.reserve(headers.size());
+        uint256 prev = state->hashes.empty() ? uint256{} : state->hashes.back();
+        for (const auto& header : headers) {
+            if (header.prev_hash != prev) {
+                Fail("getheaders", "headers do not connect");
+            }
+            prev = header.GetHash();
+            hashes.push_back(prev);
+        }
+
+        for (size_t offset = 0; offset < hashes.size(); offset += BLOCK_WINDOW) {
+            std::vector<uint256> window(hashes.begin() + offset,
+                                        hashes.begin() + std::min(hashes.size(), offset + BLOCK_WINDOW));
+            auto blocks_result = peer.GetBlocks(window);
+            if (blocks_result.IsError()) {
+                Fail("getblock", blocks_result.error);
+            }
+
+            for (size_t i = 0; i < window.size(); ++i) {
+                std::vector<Transaction> matched;
+                for (const auto& raw : blocks_result.GetValue()[i]) {
+                    auto tx_result = Transaction::Deserialize(raw);
+                    if (tx_result.IsError()) {
+                        Fail("block", tx_result.error);
+                    }
+                    matched.push_back(tx_result.GetValue());
+                }
+                state->txs_matched += matched.size();
+
+                sdk.NotifyBlockConnected(state->hashes.size(), window[i], matched);
+                state->hashes.push_back(window[i]);
+                ++state->blocks_connected;
+            }
+        }
+    }
+}
+
+bench::NodeSimConfig MakeConfig(uint64_t blocks) {
+    bench::NodeSimConfig config;
+    config.chain_length = blocks;
+    for (size_t i = 0; i < WALLET_ADDRESSES; ++i) {
+        config.wallet_addresses.push_back(bench::MockWallet().addresses[i].address);
+    }
+    return config;
+}
+
+std::unique_ptr<MobileSDK> OpenSDK(const std::string& dir, const std::string& name) {
+    SDKConfig config;
+    config.wallet_path = dir + "/" + name;
+    std::filesystem::create_directories(config.wallet_path);
+    auto sdk = std::make_unique<MobileSDK>(config);
+    auto open_result = sdk->OpenWallet("bench");
+    if (open_result.IsError()) {
+        Fail("open wallet", open_result.error);
+    }
+    auto sync_result = sdk->StartSync();
+    if (sync_result.IsError()) {
+        Fail("start sync", sync_result.error);
+    }
+    return sdk;
+}
+
+void RunSync(const Options& options, const std::string& dir) {
+    for (const auto& profile : SYNC_PROFILES) {
+        bench::NodeSimConfig config = MakeConfig(options.blocks);
+        config.latency = std::chrono::milliseconds(profile.latency_ms);
+        config.bandwidth_bytes_per_sec = profile.bandwidth;
+
+        bench::NodeSimulator sim(config);
+        auto start_result = sim.Start();
+        if (start_result.IsError()) {
+            Fail("simulator", start_result.error);
+        }
+
+        auto sdk = OpenSDK(dir, std::string("sync_") + profile.name);
+        bench::SimPeerClient peer;
+        auto connect_result = peer.Connect(sim.GetP2PPort());
+        if (connect_result.IsError()) {
+            Fail("connect", connect_result.error);
+        }
+
+        SyncState state;
+        auto start = bench::Clock::now();
+        SyncToTip(peer, *sdk, &state);
+        uint64_t ns = bench::ElapsedNs(start);
+
+        bench::NodeSimStats stats = sim.GetStats();
+        bench::Report("sync_send")
+            .Add("scope", "sdk_bookkeeping")
+            .Add("op", "sync")
+            .Add("link", profile.name)
+            .Add("latency_ms", static_cast<uint64_t>(profile.latency_ms))
+            .Add("bandwidth_bytes_per_sec", profile.bandwidth)
+            .Add("blocks", state.blocks_connected)
+            .Add("txs_matched", state.txs_matched)
+            .Add("bytes_received", stats.bytes_sent)
+            .Add("blocks_per_sec", state.blocks_connected * 1e9 / static_cast<double>(ns))
+            .Add("tip_matches", static_cast<uint64_t>(state.hashes.back() == sim.GetTipHash()))
+            .Print();
+
+        peer.Close();
+        sdk->StopSync();
+        sdk->CloseWallet();
+        sim.Stop();
+    }
+}
+
+void RunReorgs(const Options& options, const std::string& dir) {
+    // A block every round, a three-block reorg every tenth
+    constexpr uint32_t ROUNDS = 200;
+    bench::NodeSimConfig config = MakeConfig(std::min<uint64_t>(options.blocks, 2000));
+    config.latency = std::chrono::milliseconds(20);
+    config.reorg_interval = 10;
+    config.reorg_depth = 3;
+
+    bench::NodeSimulator sim(config);
+    auto start_result = sim.Start();
+    if (start_result.IsError()) {
+        Fail("simulator", start_result.error);
+    }
+
+    auto sdk = OpenSDK(dir, "reorg");
+    bench::SimPeerClient peer;
+    auto connect_result = peer.Connect(sim.GetP2PPort());
+    if (connect_result.IsError()) {
+        Fail("connect", connect_result.error);
+    }
+
+    SyncState state;
+    SyncToTip(peer, *sdk, &state);
+    uint64_t connected_before = state.blocks_connected;
+
+    std::vector<uint64_t> reorg_ns;
+    std::vector<uint64_t> block_ns;
+    for (uint32_t round = 0; round < ROUNDS; ++round) {
+        uint64_t disconnected = state.blocks_disconnected;
+        sim.MineBlocks(1);
+
+        auto start = bench::Clock::now();
+        SyncToTip(peer, *sdk, &state);
+        uint64_t ns = bench::ElapsedNs(start);
+        (state.blocks_disconnected > disconnected ? reorg_ns : block_ns).push_back(ns);
+    }
+
+    std::sort(reorg_ns.begin(), reorg_ns.end());
+    std::sort(block_ns.begin(), block_ns.end());
+    auto median_ms = [](const std::vector<uint64_t>& ns) {
+        return ns.empty() ? 0.0 : static_cast<double>(ns[ns.size() / 2]) / 1e6;
+    };
+
+    bench::Report("sync_send")
+        .Add("scope", "sdk_bookkeeping")
+        .Add("op", "reorg")
+        .Add("latency_ms", static_cast<uint64_t>(20))
+        .Add("rounds", static_cast<uint64_t>(ROUNDS))
+        .Add("reorgs", sim.GetStats().reorgs)
+        .Add("blocks_connected", state.blocks_connected - connected_before)
+        .Add("blocks_disconnected", state.blocks_disconnected)
+        .Add("new_block_catchup_ms_p50", median_ms(block_ns))
+        .Add("reorg_catchup_ms_p50", median_ms(reorg_ns))
+        .Add("tip_matches", static_cast<uint64_t>(state.hashes.back() == sim.GetTipHash()))
+        .Print();
+
+    peer.Close();
+    sdk->StopSync();
+    sdk->CloseWallet();
+    sim.Stop();
+}
+
+/// Serialized transaction spending one mock wallet coin to a fresh address
+std::vector<uint8_t> MakeSpend(size_t index) {
+    const auto& utxo = bench::MockWallet().utxos[index];
+    TxInputCoin coin{utxo.outpoint.tx_hash, utxo.outpoint.index, utxo.value};
+    std::vector<TxRecipient> recipients = {{bench::MockAddress(100000 + index), utxo.value > 2000 ? utxo.value - 1000 : 1}};
+    auto tx_result = BuildUnsignedTransaction({coin}, recipients, "", 0);
+    if (tx_result.IsError()) {
+        Fail("build transaction", tx_result.error);
+    }
+    return tx_result.GetValue().Serialize();
+}
+
+void ReportLatency(const char* op, const LinkProfile& profile, std::vector<uint64_t> ns) {
+    std::sort(ns.begin(), ns.end());
+    auto percentile_ms = [&](double p) {
+        return static_cast<double>(ns[std::min(ns.size() - 1, static_cast<size_t>(p * ns.size()))]) / 1e6;
+    };
+    bench::Report("sync_send")
+        .Add("scope", "sdk_bookkeeping")
+        .Add("op", op)
+        .Add("link", profile.name)
+        .Add("latency_ms", static_cast<uint64_t>(profile.latency_ms))
+        .Add("sends", static_cast<uint64_t>(ns.size()))
+        .Add("ms_p50", percentile_ms(0.50))
+        .Add("ms_p99", percentile_ms(0.99))
+        .Add("ms_max", static_cast<double>(ns.back()) / 1e6)
+        .Print();
+}
+
+void RunSends(const Options& options, const std::string& dir) {
+    bench::NodeSimulator sim(MakeConfig(2));
+    auto start_result = sim.Start();
+    if (start_result.IsError()) {
+        Fail("simulator", start_result.error);
+    }
+
+    // The SDK's broadcast queue relays through the mock SPV client to here
+    bench::SimPeerClient peer;
+    auto connect_result = peer.Connect(sim.GetP2PPort());
+    if (connect_result.IsError()) {
+        Fail("connect", connect_result.error);
+    }
+    bench::SetMockBroadcastHandler([&peer](const std::vector<uint8_t>& raw_tx) {
+        auto send_result = peer.SendTransaction(raw_tx);
+        return send_result.IsOk() ? Result<void>::Ok() : Result<void>::Error(send_result.error);
+    });
+
+    auto sdk = OpenSDK(dir, "send");
+
+    // Every send spends a coin no earlier send used
+    size_t next_coin = 0;
+    for (const auto& profile : SEND_PROFILES) {
+        sim.SetLatency(std::chrono::milliseconds(profile.latency_ms));
+
+        std::vector<uint64_t> sdk_ns;
+        std::vector<uint64_t> rpc_ns;
+        for (size_t i = 0; i < options.sends; ++i) {
+            std::vector<uint8_t> raw = MakeSpend(next_coin++);
+            auto start = bench::Clock::now();
+            auto send_result = sdk->SendRawTransaction(raw);
+            if (send_result.IsError()) {
+                Fail("SendRawTransaction", send_result.error);
+            }
+            if (!sim.WaitForTransaction(send_result.GetValue(), std::chrono::seconds(10))) {
+                Fail("SendRawTransaction", "not relayed within 10s");
+            }
+            sdk_ns.push_back(bench::ElapsedNs(start));
+
+            raw = MakeSpend(next_coin++);
+            start = bench::Clock::now();
+            auto rpc_result = bench::SimRPCCall(sim.GetRPCPort(), "sendrawtransaction", "[\"" + BytesToHex(raw) + "\"]");
+            if (rpc_result.IsError()) {
+                Fail("sendrawtransaction", rpc_result.error);
+            }
+            rpc_ns.push_back(bench::ElapsedNs(start));
+        }
+
+        ReportLatency("sdk.SendRawTransaction", profile, sdk_ns);
+        ReportLatency("rpc.sendrawtransaction", profile, rpc_ns);
+    }
+
+    sdk->StopSync();
+    sdk->CloseWallet();
+    bench::SetMockBroadcastHandler(nullptr);
+    peer.Close();
+    sim.Stop();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, &options)) {
+        std::fprintf(stderr, "usage: %s [--blocks=10000] [--sends=200]\n", argv[0]);
+        return 2;
+    }
+
+    // Enough coins for every send, each spent once
+    size_t coins_needed = 2 * options.sends * (sizeof(SEND_PROFILES) / sizeof(SEND_PROFILES[0]));
+    bench::PopulateMockWallet(std::max<size_t>(1000, coins_needed * 4 + 4));
+
+    auto dir = std::filesystem::temp_directory_path() / ("intcoin_bench_" + std::to_string(bench::Clock::now().time_since_epoch().count()));
+    std::filesystem::create_directories(dir);
+
+    RunSync(options, dir.string());
+    RunReorgs(options, dir.string());
+    RunSends(options, dir.string());
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
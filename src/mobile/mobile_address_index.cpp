@@ -0,0 +1,558 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_address_index.h>
+#include <intcoin/mobile_tx_builder.h>
+#include <intcoin/crypto.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <unordered_map>
+
+namespace intcoin {
+namespace mobile {
+
+ScriptHash ScriptHashOf(const Script& script) {
+    return SHA3::Hash(script.bytes);
+}
+
+Result<ScriptHash> ScriptHashForAddress(const std::string& address) {
+    auto script_result = ScriptForAddress(address);
+    if (script_result.IsError()) {
+        return Result<ScriptHash>::Error(script_result.error);
+    }
+    return Result<ScriptHash>::Ok(ScriptHashOf(script_result.GetValue()));
+}
+
+// ========================================
+// AddressIndex
+// ========================================
+
+size_t AddressIndex::Uint256Hasher::operator()(const uint256& hash) const {
+    // Transaction and script hashes are uniformly distributed already
+    size_t value;
+    std::memcpy(&value, hash.data(), sizeof(value));
+    return value;
+}
+
+size_t AddressIndex::CoinKeyHasher::operator()(const CoinKey& key) const {
+    return Uint256Hasher()(key.tx_hash) ^ (static_cast<size_t>(key.output_index) * 0x9E3779B97F4A7C15ULL);
+}
+
+AddressIndex::ScriptEntry::ScriptEntry(uint32_t account_id, MemoryTracker& memory)
+    : account(account_id),
+      coins(memory.Account(MemorySubsystem::UTXO_SET)),
+      history(memory.Allocator<IndexedHistoryEntry>(MemorySubsystem::HISTORY)),
+      history_pos(0, Uint256Hasher(), std::equal_to<uint256>(),
+                  memory.Allocator<std::pair<const uint256, size_t>>(MemorySubsystem::HISTORY)) {
+}
+
+AddressIndex::BlockUndo::BlockUndo(MemoryAccount* account)
+    : created(TrackedAllocator<CoinKey>(account)),
+      confirmed(TrackedAllocator<CoinKey>(account)),
+      spent(TrackedAllocator<Coin>(account)),
+      history_created(TrackedAllocator<std::pair<uint32_t, uint256>>(account)),
+      history_confirmed(TrackedAllocator<std::pair<uint32_t, uint256>>(account)) {
+}
+
+AddressIndex::AddressIndex(size_t max_reorg_depth)
+    : max_reorg_depth_(max_reorg_depth),
+      scripts_(memory_.Allocator<ScriptEntry>(MemorySubsystem::ADDRESS_BOOK)),
+      script_by_hash_(0, Uint256Hasher(), std::equal_to<ScriptHash>(),
+                      memory_.Allocator<std::pair<const ScriptHash, uint32_t>>(MemorySubsystem::ADDRESS_BOOK)),
+      coins_(memory_.Allocator<Coin>(MemorySubsystem::UTXO_SET)),
+      free_coins_(memory_.Allocator<uint32_t>(MemorySubsystem::UTXO_SET)),
+      coin_by_key_(0, CoinKeyHasher(), std::equal_to<CoinKey>(),
+                   memory_.Allocator<std::pair<const CoinKey, uint32_t>>(MemorySubsystem::UTXO_SET)),
+      accounts_(0, std::hash<uint32_t>(), std::equal_to<uint32_t>(),
+                memory_.Allocator<std::pair<const uint32_t, CoinList>>(MemorySubsystem::UTXO_SET)),
+      wallet_(memory_.Account(MemorySubsystem::UTXO_SET)),
+      tx_scripts_(0, Uint256Hasher(), std::equal_to<uint256>(),
+                  memory_.Allocator<std::pair<const uint256, TrackedVector<uint32_t>>>(MemorySubsystem::HISTORY)),
+      undo_(std::less<uint64_t>(),
+            memory_.Allocator<std::pair<const uint64_t, BlockUndo>>(MemorySubsystem::UTXO_SET)) {
+}
+
+std::shared_ptr<AddressIndex> AddressIndex::FromWallet(wallet::Wallet& wallet,
+                                                       const std::vector<Transaction>& unconfirmed) {
+    auto index = std::make_shared<AddressIndex>();
+
+    // One account (m/44'/2210'/0'); receiving and change addresses alike
+    auto addrs_result = wallet.GetAddresses();
+    if (addrs_result.IsOk()) {
+        for (const auto& addr_info : *addrs_result.value) {
+            index->Watch(addr_info.address);
+        }
+    }
+
+    std::vector<std::pair<ScriptHash, IndexedUTXO>> coins;
+    std::unordered_map<uint256, std::vector<size_t>, Uint256Hasher> coins_by_tx;
+    auto utxos_result = wallet.GetUTXOs();
+    if (utxos_result.IsOk()) {
+        for (const auto& utxo : *utxos_result.value) {
+            auto hash_result = ScriptHashForAddress(utxo.address);
+            if (hash_result.IsError()) {
+                continue;
+            }
+            IndexedUTXO indexed;
+            indexed.tx_hash = utxo.outpoint.tx_hash;
+            indexed.output_index = utxo.outpoint.index;
+            indexed.amount = utxo.value;
+            indexed.block_height = utxo.block_height;
+            coins_by_tx[indexed.tx_hash].push_back(coins.size());
+            coins.emplace_back(hash_result.GetValue(), indexed);
+        }
+    }
+
+    // The wallet lists history newest first; walk it oldest first so each
+    // script's history is in chain order
+    auto history_result = wallet.GetTransactionHistory();
+    if (history_result.IsOk()) {
+        const auto& history = *history_result.value;
+        for (auto it = history.rbegin(); it != history.rend(); ++it) {
+            auto tx_it = coins_by_tx.find(it->tx_hash);
+            if (tx_it == coins_by_tx.end()) {
+                continue;
+            }
+            for (size_t coin : tx_it->second) {
+                index->AddUTXO(coins[coin].first, coins[coin].second);
+            }
+        }
+    }
+
+    // Coins whose transaction the history does not list (already indexed
+    // coins are skipped)
+    for (const auto& [script_hash, utxo] : coins) {
+        index->AddUTXO(script_hash, utxo);
+    }
+
+    for (const auto& tx : unconfirmed) {
+        index->AddTransaction(tx);
+    }
+
+    return index;
+}
+
+Result<ScriptHash> AddressIndex::Watch(const std::string& address, uint32_t account) {
+    auto hash_result = ScriptHashForAddress(address);
+    if (hash_result.IsError()) {
+        return hash_result;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const ScriptHash& script_hash = hash_result.GetValue();
+    if (script_by_hash_.find(script_hash) == script_by_hash_.end()) {
+        script_by_hash_.emplace(script_hash, static_cast<uint32_t>(scripts_.size()));
+        scripts_.emplace_back(account, memory_);
+        accounts_.try_emplace(account, memory_.Account(MemorySubsystem::UTXO_SET));
+    }
+
+    return hash_result;
+}
+
+bool AddressIndex::IsWatched(const ScriptHash& script_hash) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return script_by_hash_.find(script_hash) != script_by_hash_.end();
+}
+
+void AddressIndex::AddUTXO(const ScriptHash& script_hash, const IndexedUTXO& utxo) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto script_it = script_by_hash_.find(script_hash);
+    if (script_it == script_by_hash_.end()) {
+        return;
+    }
+    uint32_t script = script_it->second;
+
+    if (!InsertCoin(script, utxo)) {
+        return;
+    }
+
+    // Only the receiving side of the transaction is known here
+    ScriptEntry& entry = scripts_[script];
+    auto pos_it = entry.history_pos.find(utxo.tx_hash);
+    if (pos_it != entry.history_pos.end()) {
+        entry.history[pos_it->second].delta_ints += static_cast<int64_t>(utxo.amount);
+        return;
+    }
+    entry.history_pos.emplace(utxo.tx_hash, entry.history.size());
+    entry.history.push_back({utxo.tx_hash, static_cast<int64_t>(utxo.amount), utxo.block_height});
+    TxScripts(utxo.tx_hash).push_back(script);
+}
+
+void AddressIndex::AddTransaction(const Transaction& tx) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ApplyTransaction(tx, 0, nullptr);
+}
+
+void AddressIndex::BlockConnected(uint64_t height, const std::vector<Transaction>& txs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    BlockUndo undo(memory_.Account(MemorySubsystem::UTXO_SET));
+    for (const auto& tx : txs) {
+        ApplyTransaction(tx, height, &undo);
+    }
+    if (!undo.created.empty() || !undo.confirmed.empty() || !undo.spent.empty() ||
+        !undo.history_created.empty() || !undo.history_confirmed.empty()) {
+        undo_.insert_or_assign(height, std::move(undo));
+    }
+
+    // Blocks this deep are not expected to be disconnected
+    while (!undo_.empty() && undo_.begin()->first + max_reorg_depth_ <= height) {
+        undo_.erase(undo_.begin());
+    }
+}
+
+void AddressIndex::BlockDisconnected(uint64_t height) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Newest first, so coins created and spent across blocks come back in order
+    while (!undo_.empty() && undo_.rbegin()->first >= height) {
+        auto last = std::prev(undo_.end());
+        BlockUndo& undo = last->second;
+
+        // Restore spends before removing creations; a coin created and spent
+        // in the same block must end up absent
+        for (auto it = undo.spent.rbegin(); it != undo.spent.rend(); ++it) {
+            InsertCoin(it->script, it->utxo);
+        }
+        for (const auto& key : undo.created) {
+            auto coin_it = coin_by_key_.find(key);
+            if (coin_it != coin_by_key_.end()) {
+                RemoveCoin(coin_it->second);
+            }
+        }
+        for (const auto& key : undo.confirmed) {
+            auto coin_it = coin_by_key_.find(key);
+            if (coin_it != coin_by_key_.end()) {
+                SetCoinHeight(coin_it->second, 0);
+            }
+        }
+        for (const auto& [script, tx_hash] : undo.history_created) {
+            EraseHistory(script, tx_hash);
+        }
+        for (const auto& [script, tx_hash] : undo.history_confirmed) {
+            SetHistoryHeight(script, tx_hash, 0);
+        }
+
+        undo_.erase(last);
+    }
+}
+
+void AddressIndex::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scripts_.clear();
+    script_by_hash_.clear();
+    coins_.clear();
+    free_coins_.clear();
+    coin_by_key_.clear();
+    accounts_.clear();
+    wallet_ = CoinList(memory_.Account(MemorySubsystem::UTXO_SET));
+    tx_scripts_.clear();
+    undo_.clear();
+}
+
+// ========================================
+// Queries
+// ========================================
+
+IndexedBalance AddressIndex::GetBalance(const ScriptHash& script_hash) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = script_by_hash_.find(script_hash);
+    return it != script_by_hash_.end() ? scripts_[it->second].coins.balance : IndexedBalance{};
+}
+
+IndexedBalance AddressIndex::GetAccountBalance(uint32_t account) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = accounts_.find(account);
+    return it != accounts_.end() ? it->second.balance : IndexedBalance{};
+}
+
+IndexedBalance AddressIndex::GetWalletBalance() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return wallet_.balance;
+}
+
+std::vector<IndexedUTXO> AddressIndex::GetUTXOs(const ScriptHash& script_hash) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = script_by_hash_.find(script_hash);
+    if (it == script_by_hash_.end()) {
+        return {};
+    }
+    return CollectUTXOs(scripts_[it->second].coins);
+}
+
+std::vector<IndexedUTXO> AddressIndex::GetAccountUTXOs(uint32_t account) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = accounts_.find(account);
+    if (it == accounts_.end()) {
+        return {};
+    }
+    return CollectUTXOs(it->second);
+}
+
+std::vector<IndexedUTXO> AddressIndex::GetWalletUTXOs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return CollectUTXOs(wallet_);
+}
+
+std::vector<IndexedHistoryEntry> AddressIndex::GetHistory(const ScriptHash& script_hash, size_t offset,
+                                                          size_t limit, size_t* total_count) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = script_by_hash_.find(script_hash);
+    const auto* history = it != script_by_hash_.end() ? &scripts_[it->second].history : nullptr;
+    size_t size = history ? history->size() : 0;
+    if (total_count) {
+        *total_count = size;
+    }
+
+    std::vector<IndexedHistoryEntry> page;
+    for (size_t i = offset; i < size && page.size() < limit; ++i) {
+        page.push_back((*history)[size - 1 - i]);
+    }
+    return page;
+}
+
+void AddressIndex::AddMemoryUsage(MemoryUsage* usage) const {
+    memory_.AddTo(usage);
+}
+
+// ========================================
+// Maintenance
+// ========================================
+
+void AddressIndex::ApplyTransaction(const Transaction& tx, uint64_t height, BlockUndo* undo) {
+    uint256 tx_hash = tx.GetHash();
+
+    // Seen before (in the mempool or from the wallet): only record the block
+    auto applied = tx_scripts_.find(tx_hash);
+    if (applied != tx_scripts_.end()) {
+        // A wallet may list a transaction's change before dropping the coins
+        // it spends
+        for (const auto& input : tx.inputs) {
+            auto coin_it = coin_by_key_.find(CoinKey{input.prev_tx_hash, input.prev_tx_index});
+            if (coin_it != coin_by_key_.end()) {
+                Coin spent = RemoveCoin(coin_it->second);
+                if (undo) {
+                    undo->spent.push_back(spent);
+                }
+            }
+        }
+        if (height == 0) {
+            return;
+        }
+        for (uint32_t script : applied->second) {
+            ScriptEntry& entry = scripts_[script];
+            IndexedHistoryEntry& history = entry.history[entry.history_pos.at(tx_hash)];
+            if (history.block_height == 0) {
+                history.block_height = height;
+                if (undo) {
+                    undo->history_confirmed.emplace_back(script, tx_hash);
+                }
+            }
+        }
+        for (uint32_t i = 0; i < tx.outputs.size(); ++i) {
+            CoinKey key{tx_hash, i};
+            auto coin_it = coin_by_key_.find(key);
+            if (coin_it != coin_by_key_.end() && coins_[coin_it->second].utxo.block_height == 0) {
+                SetCoinHeight(coin_it->second, height);
+                if (undo) {
+                    undo->confirmed.push_back(key);
+                }
+            }
+        }
+        return;
+    }
+
+    // Net effect on each watched script; transactions touch only a few
+    std::vector<std::pair<uint32_t, int64_t>> deltas;
+    auto add_delta = [&deltas](uint32_t script, int64_t amount) {
+        for (auto& [existing, delta] : deltas) {
+            if (existing == script) {
+                delta += amount;
+                return;
+            }
+        }
+        deltas.emplace_back(script, amount);
+    };
+
+    for (const auto& input : tx.inputs) {
+        auto coin_it = coin_by_key_.find(CoinKey{input.prev_tx_hash, input.prev_tx_index});
+        if (coin_it == coin_by_key_.end()) {
+            continue;
+        }
+        Coin spent = RemoveCoin(coin_it->second);
+        add_delta(spent.script, -static_cast<int64_t>(spent.utxo.amount));
+        if (undo) {
+            undo->spent.push_back(spent);
+        }
+    }
+
+    for (uint32_t i = 0; i < tx.outputs.size(); ++i) {
+        const auto& output = tx.outputs[i];
+        auto script_it = script_by_hash_.find(ScriptHashOf(output.script_pubkey));
+        if (script_it == script_by_hash_.end()) {
+            continue;
+        }
+        if (InsertCoin(script_it->second, IndexedUTXO{tx_hash, i, output.value, height}) && undo) {
+            undo->created.push_back(CoinKey{tx_hash, i});
+        }
+        add_delta(script_it->second, static_cast<int64_t>(output.value));
+    }
+
+    if (deltas.empty()) {
+        return;
+    }
+
+    auto& scripts = TxScripts(tx_hash);
+    for (const auto& [script, delta] : deltas) {
+        ScriptEntry& entry = scripts_[script];
+        entry.history_pos.emplace(tx_hash, entry.history.size());
+        entry.history.push_back({tx_hash, delta, height});
+        scripts.push_back(script);
+        if (undo) {
+            undo->history_created.emplace_back(script, tx_hash);
+        }
+    }
+}
+
+bool AddressIndex::InsertCoin(uint32_t script, const IndexedUTXO& utxo) {
+    CoinKey key{utxo.tx_hash, utxo.output_index};
+    if (coin_by_key_.find(key) != coin_by_key_.end()) {
+        return false;
+    }
+
+    uint32_t slot;
+    if (!free_coins_.empty()) {
+        slot = free_coins_.back();
+        free_coins_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(coins_.size());
+        coins_.emplace_back();
+    }
+
+    CoinList& script_list = scripts_[script].coins;
+    CoinList& account_list = accounts_.at(scripts_[script].account);
+
+    Coin& coin = coins_[slot];
+    coin.utxo = utxo;
+    coin.script = script;
+    coin.script_pos = script_list.coins.size();
+    coin.account_pos = account_list.coins.size();
+    coin.wallet_pos = wallet_.coins.size();
+
+    script_list.coins.push_back(slot);
+    account_list.coins.push_back(slot);
+    wallet_.coins.push_back(slot);
+    Credit(script_list, utxo, 1);
+    Credit(account_list, utxo, 1);
+    Credit(wallet_, utxo, 1);
+
+    coin_by_key_.emplace(key, slot);
+    return true;
+}
+
+AddressIndex::Coin AddressIndex::RemoveCoin(uint32_t slot) {
+    Coin coin = coins_[slot];
+
+    // Swap the last coin of each list into the removed coin's place
+    auto unlink = [this](CoinList& list, size_t pos, size_t Coin::*position) {
+        uint32_t moved = list.coins.back();
+        list.coins[pos] = moved;
+        coins_[moved].*position = pos;
+        list.coins.pop_back();
+    };
+
+    CoinList& script_list = scripts_[coin.script].coins;
+    CoinList& account_list = accounts_.at(scripts_[coin.script].account);
+    unlink(script_list, coin.script_pos, &Coin::script_pos);
+    unlink(account_list, coin.account_pos, &Coin::account_pos);
+    unlink(wallet_, coin.wallet_pos, &Coin::wallet_pos);
+    Credit(script_list, coin.utxo, -1);
+    Credit(account_list, coin.utxo, -1);
+    Credit(wallet_, coin.utxo, -1);
+
+    coin_by_key_.erase(CoinKey{coin.utxo.tx_hash, coin.utxo.output_index});
+    free_coins_.push_back(slot);
+    return coin;
+}
+
+void AddressIndex::SetCoinHeight(uint32_t slot, uint64_t block_height) {
+    Coin& coin = coins_[slot];
+    CoinList& script_list = scripts_[coin.script].coins;
+    CoinList& account_list = accounts_.at(scripts_[coin.script].account);
+
+    Credit(script_list, coin.utxo, -1);
+    Credit(account_list, coin.utxo, -1);
+    Credit(wallet_, coin.utxo, -1);
+    coin.utxo.block_height = block_height;
+    Credit(script_list, coin.utxo, 1);
+    Credit(account_list, coin.utxo, 1);
+    Credit(wallet_, coin.utxo, 1);
+}
+
+void AddressIndex::Credit(CoinList& list, const IndexedUTXO& utxo, int sign) {
+    uint64_t& total = utxo.block_height != 0 ? list.balance.confirmed : list.balance.unconfirmed;
+    if (sign > 0) {
+        total += utxo.amount;
+        ++list.balance.utxo_count;
+    } else {
+        total -= utxo.amount;
+        --list.balance.utxo_count;
+    }
+}
+
+void AddressIndex::EraseHistory(uint32_t script, const uint256& tx_hash) {
+    ScriptEntry& entry = scripts_[script];
+    auto pos_it = entry.history_pos.find(tx_hash);
+    if (pos_it == entry.history_pos.end()) {
+        return;
+    }
+
+    // Keeps history in order; only reorgs get here, and they remove recent entries
+    size_t pos = pos_it->second;
+    entry.history_pos.erase(pos_it);
+    entry.history.erase(entry.history.begin() + pos);
+    for (size_t i = pos; i < entry.history.size(); ++i) {
+        entry.history_pos[entry.history[i].tx_hash] = i;
+    }
+
+    auto tx_it = tx_scripts_.find(tx_hash);
+    if (tx_it != tx_scripts_.end()) {
+        auto& scripts = tx_it->second;
+        scripts.erase(std::remove(scripts.begin(), scripts.end(), script), scripts.end());
+        if (scripts.empty()) {
+            tx_scripts_.erase(tx_it);
+        }
+    }
+}
+
+void AddressIndex::SetHistoryHeight(uint32_t script, const uint256& tx_hash, uint64_t block_height) {
+    ScriptEntry& entry = scripts_[script];
+    auto pos_it = entry.history_pos.find(tx_hash);
+    if (pos_it != entry.history_pos.end()) {
+        entry.history[pos_it->second].block_height = block_height;
+    }
+}
+
+TrackedVector<uint32_t>& AddressIndex::TxScripts(const uint256& tx_hash) {
+    auto it = tx_scripts_.find(tx_hash);
+    if (it == tx_scripts_.end()) {
+        it = tx_scripts_.emplace(tx_hash, memory_.Allocator<uint32_t>(MemorySubsystem::HISTORY)).first;
+    }
+    return it->second;
+}
+
+std::vector<IndexedUTXO> AddressIndex::CollectUTXOs(const CoinList& list) const {
+    std::vector<IndexedUTXO> utxos;
+    utxos.reserve(list.coins.size());
+    for (uint32_t slot : list.coins) {
+        utxos.push_back(coins_[slot].utxo);
+    }
+    return utxos;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,279 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_address_validation.h>
+
+#include <array>
+#include <vector>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+constexpr size_t MAX_ADDRESS_LENGTH = 90;
+constexpr size_t CHECKSUM_LENGTH = 6;
+
+/// Data part before the checksum, in characters (five-bit groups); the
+/// length ValidateAddress required of Bech32::Decode's data
+constexpr size_t MIN_PAYLOAD_CHARS = 32;
+constexpr size_t MIN_DATA_LENGTH = MIN_PAYLOAD_CHARS + CHECKSUM_LENGTH;
+
+/// Final polymod value of a valid checksum (BIP 173 Bech32, as Bech32::Decode expects)
+constexpr uint32_t BECH32_CONST = 1;
+
+constexpr uint32_t GENERATOR[5] = {0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3};
+
+constexpr char CHARSET[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+/// Addresses checked together per polymod pass
+constexpr size_t LANES = 8;
+
+/// One polymod step, without branches so lanes can run side by side
+constexpr uint32_t PolymodStep(uint32_t chk, uint32_t value) {
+    uint32_t top = chk >> 25;
+    chk = ((chk & 0x1ffffff) << 5) ^ value;
+    for (int i = 0; i < 5; ++i) {
+        chk ^= (0u - ((top >> i) & 1)) & GENERATOR[i];
+    }
+    return chk;
+}
+
+/// Polymod state after the expanded HRP
+constexpr uint32_t HrpState(std::string_view hrp) {
+    uint32_t chk = 1;
+    for (char c : hrp) {
+        chk = PolymodStep(chk, static_cast<uint8_t>(c) >> 5);
+    }
+    chk = PolymodStep(chk, 0);
+    for (char c : hrp) {
+        chk = PolymodStep(chk, static_cast<uint8_t>(c) & 31);
+    }
+    return chk;
+}
+
+// The two HRPs are fixed, so their contribution to the checksum is too
+constexpr uint32_t MAINNET_HRP_STATE = HrpState("int");
+constexpr uint32_t TESTNET_HRP_STATE = HrpState("tint");
+
+/// Character to 5-bit value (either case), -1 if not in the character set
+constexpr std::array<int8_t, 256> MakeCharsetReverse() {
+    std::array<int8_t, 256> table{};
+    for (auto& entry : table) {
+        entry = -1;
+    }
+    for (int i = 0; i < 32; ++i) {
+        char c = CHARSET[i];
+        table[static_cast<uint8_t>(c)] = static_cast<int8_t>(i);
+        if (c >= 'a' && c <= 'z') {
+            table[static_cast<uint8_t>(c - 'a' + 'A')] = static_cast<int8_t>(i);
+        }
+    }
+    return table;
+}
+
+constexpr std::array<int8_t, 256> CHARSET_REV = MakeCharsetReverse();
+
+/// Address that passed every check but the checksum
+struct Candidate {
+    const char* data;  // Characters after the separator
+    size_t length;
+    uint32_t state;    // Polymod state after the HRP
+};
+
+/// Prefixes are matched in lower case only, as ValidateAddress always has
+bool HasPrefix(std::string_view address, std::string_view prefix) {
+    return address.substr(0, prefix.size()) == prefix;
+}
+
+AddressError Precheck(std::string_view address, AddressNetwork network, Candidate* candidate) {
+    if (address.size() > MAX_ADDRESS_LENGTH) {
+        return AddressError::TOO_LONG;
+    }
+
+    size_t prefix_length;
+    AddressNetwork found;
+    if (HasPrefix(address, "int1")) {
+        prefix_length = 4;
+        found = AddressNetwork::MAINNET;
+        candidate->state = MAINNET_HRP_STATE;
+    } else if (HasPrefix(address, "tint1")) {
+        prefix_length = 5;
+        found = AddressNetwork::TESTNET;
+        candidate->state = TESTNET_HRP_STATE;
+    } else {
+        return AddressError::UNKNOWN_PREFIX;
+    }
+    if (network != AddressNetwork::ANY && network != found) {
+        return AddressError::WRONG_NETWORK;
+    }
+
+    bool has_lower = false;
+    bool has_upper = false;
+    for (size_t i = 0; i < address.size(); ++i) {
+        char c = address[i];
+        has_lower |= c >= 'a' && c <= 'z';
+        has_upper |= c >= 'A' && c <= 'Z';
+        if (i >= prefix_length && CHARSET_REV[static_cast<uint8_t>(c)] < 0) {
+            return AddressError::INVALID_CHARACTER;
+        }
+    }
+    if (has_lower && has_upper) {
+        return AddressError::MIXED_CASE;
+    }
+
+    candidate->data = address.data() + prefix_length;
+    candidate->length = address.size() - prefix_length;
+    if (candidate->length < MIN_DATA_LENGTH) {
+        return AddressError::TOO_SHORT;
+    }
+
+    return AddressError::OK;
+}
+
+/// Addresses of one data length waiting for a polymod pass
+struct LaneGroup {
+    size_t count = 0;
+    size_t index[LANES];
+    const char* data[LANES];
+    uint32_t state[LANES];
+};
+
+/// Run the checksum of every lane in a group and record the results
+size_t RunGroup(LaneGroup& group, size_t length, AddressError* errors_out) {
+    // Idle lanes repeat lane 0 so the loop body stays uniform
+    for (size_t lane = group.count; lane < LANES; ++lane) {
+        group.data[lane] = group.data[0];
+        group.state[lane] = group.state[0];
+    }
+
+    uint32_t state[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        state[lane] = group.state[lane];
+    }
+
+    for (size_t pos = 0; pos < length; ++pos) {
+        uint32_t values[LANES];
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            values[lane] = static_cast<uint32_t>(CHARSET_REV[static_cast<uint8_t>(group.data[lane][pos])]);
+        }
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            state[lane] = PolymodStep(state[lane], values[lane]);
+        }
+    }
+
+    size_t valid = 0;
+    for (size_t lane = 0; lane < group.count; ++lane) {
+        bool ok = state[lane] == BECH32_CONST;
+        errors_out[group.index[lane]] = ok ? AddressError::OK : AddressError::INVALID_CHECKSUM;
+        valid += ok ? 1 : 0;
+    }
+
+    group.count = 0;
+    return valid;
+}
+
+/// Regroup five-bit values into bytes (BIP 173 convertbits without padding)
+bool RegroupToBytes(const char* data, size_t length, uint8_t* out, size_t out_size) {
+    uint32_t acc = 0;
+    int bits = 0;
+    size_t written = 0;
+    for (size_t i = 0; i < length; ++i) {
+        acc = ((acc << 5) | static_cast<uint32_t>(CHARSET_REV[static_cast<uint8_t>(data[i])])) & 0xFFF;
+        bits += 5;
+        if (bits >= 8) {
+            bits -= 8;
+            if (written == out_size) {
+                return false;
+            }
+            out[written++] = static_cast<uint8_t>(acc >> bits);
+        }
+    }
+    return written == out_size && bits < 5 && (acc & ((1u << bits) - 1)) == 0;
+}
+
+}  // namespace
+
+const char* AddressErrorString(AddressError error) {
+    switch (error) {
+        case AddressError::OK: return "valid";
+        case AddressError::TOO_SHORT: return "too short";
+        case AddressError::TOO_LONG: return "too long";
+        case AddressError::UNKNOWN_PREFIX: return "unknown prefix";
+        case AddressError::WRONG_NETWORK: return "wrong network";
+        case AddressError::INVALID_CHARACTER: return "invalid character";
+        case AddressError::MIXED_CASE: return "mixed case";
+        case AddressError::INVALID_CHECKSUM: return "invalid checksum";
+        case AddressError::INVALID_PROGRAM: return "invalid payload";
+    }
+    return "unknown error";
+}
+
+AddressError ValidateAddressFast(std::string_view address, AddressNetwork network) {
+    Candidate candidate;
+    AddressError error = Precheck(address, network, &candidate);
+    if (error != AddressError::OK) {
+        return error;
+    }
+
+    uint32_t state = candidate.state;
+    for (size_t i = 0; i < candidate.length; ++i) {
+        state = PolymodStep(state, static_cast<uint32_t>(CHARSET_REV[static_cast<uint8_t>(candidate.data[i])]));
+    }
+    return state == BECH32_CONST ? AddressError::OK : AddressError::INVALID_CHECKSUM;
+}
+
+AddressError DecodeAddressProgram(std::string_view address, AddressProgram* program_out,
+                                  AddressNetwork network) {
+    AddressError error = ValidateAddressFast(address, network);
+    if (error != AddressError::OK) {
+        return error;
+    }
+
+    // Passed above, so this only locates the data part
+    Candidate candidate;
+    Precheck(address, network, &candidate);
+
+    AddressProgram program;
+    if (!RegroupToBytes(candidate.data, candidate.length - CHECKSUM_LENGTH,
+                        program.data(), program.size())) {
+        return AddressError::INVALID_PROGRAM;
+    }
+    *program_out = program;
+    return AddressError::OK;
+}
+
+size_t ValidateAddresses(const std::string_view* addresses, size_t count,
+                         AddressError* errors_out, AddressNetwork network) {
+    // Payout files hold one address type, so nearly every group fills up
+    std::vector<LaneGroup> groups(MAX_ADDRESS_LENGTH + 1);
+    size_t valid = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        Candidate candidate;
+        AddressError error = Precheck(addresses[i], network, &candidate);
+        if (error != AddressError::OK) {
+            errors_out[i] = error;
+            continue;
+        }
+
+        LaneGroup& group = groups[candidate.length];
+        group.index[group.count] = i;
+        group.data[group.count] = candidate.data;
+        group.state[group.count] = candidate.state;
+        if (++group.count == LANES) {
+            valid += RunGroup(group, candidate.length, errors_out);
+        }
+    }
+
+    for (size_t length = 0; length < groups.size(); ++length) {
+        if (groups[length].count > 0) {
+            valid += RunGroup(groups[length], length, errors_out);
+        }
+    }
+
+    return valid;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,186 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_amount.h>
+
+#include <cstring>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+/// "00" through "99", so digits are written two per division
+constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+constexpr char UNIT_SUFFIX[] = " INT";
+
+size_t DigitCount(uint64_t value) {
+    size_t count = 1;
+    while (value >= 10) {
+        value /= 10;
+        ++count;
+    }
+    return count;
+}
+
+/// Write value in exactly width digits ending at end
+void WriteDigitsBackward(char* end, uint64_t value, size_t width) {
+    while (width >= 2) {
+        const char* pair = &DIGIT_PAIRS[(value % 100) * 2];
+        value /= 100;
+        *--end = pair[1];
+        *--end = pair[0];
+        width -= 2;
+    }
+    if (width == 1) {
+        *--end = static_cast<char>('0' + value % 10);
+    }
+}
+
+/// Format into a scratch buffer of MAX_AMOUNT_CHARS bytes
+/// @return Characters written
+size_t FormatMagnitude(char* buf, bool negative, uint64_t ints, const AmountFormat& format) {
+    char* p = buf;
+    if (negative) {
+        *p++ = '-';
+    }
+
+    uint64_t int_part = ints / INTS_PER_INT;
+    uint64_t frac_part = ints % INTS_PER_INT;
+
+    size_t int_digits = DigitCount(int_part);
+    p += int_digits;
+    WriteDigitsBackward(p, int_part, int_digits);
+
+    if (!format.trim_zeros || frac_part != 0) {
+        *p++ = '.';
+        p += INT_DECIMALS;
+        WriteDigitsBackward(p, frac_part, INT_DECIMALS);
+        if (format.trim_zeros) {
+            while (p[-1] == '0') {
+                --p;
+            }
+        }
+    }
+
+    if (format.unit_suffix) {
+        std::memcpy(p, UNIT_SUFFIX, sizeof(UNIT_SUFFIX) - 1);
+        p += sizeof(UNIT_SUFFIX) - 1;
+    }
+
+    return static_cast<size_t>(p - buf);
+}
+
+AmountToCharsResult CopyOut(char* first, char* last, const char* buf, size_t len) {
+    if (static_cast<size_t>(last - first) < len) {
+        return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, buf, len);
+    return {first + len, std::errc()};
+}
+
+}  // namespace
+
+AmountToCharsResult AmountToChars(char* first, char* last, uint64_t ints, const AmountFormat& format) {
+    char buf[MAX_AMOUNT_CHARS];
+    size_t len = FormatMagnitude(buf, false, ints, format);
+    return CopyOut(first, last, buf, len);
+}
+
+AmountToCharsResult SignedAmountToChars(char* first, char* last, int64_t ints, const AmountFormat& format) {
+    // Negate in unsigned arithmetic so INT64_MIN does not overflow
+    bool negative = ints < 0;
+    uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(ints) : static_cast<uint64_t>(ints);
+
+    char buf[MAX_AMOUNT_CHARS];
+    size_t len = FormatMagnitude(buf, negative, magnitude, format);
+    return CopyOut(first, last, buf, len);
+}
+
+AmountFromCharsResult AmountFromChars(const char* first, const char* last, uint64_t& ints) {
+    const char* p = first;
+    bool overflow = false;
+
+    uint64_t int_part = 0;
+    size_t int_digits = 0;
+    for (; p < last && *p >= '0' && *p <= '9'; ++p, ++int_digits) {
+        uint64_t digit = static_cast<uint64_t>(*p - '0');
+        if (int_part > (UINT64_MAX - digit) / 10) {
+            overflow = true;  // Keep consuming digits, as std::from_chars does
+        } else {
+            int_part = int_part * 10 + digit;
+        }
+    }
+
+    uint64_t frac_part = 0;
+    size_t frac_digits = 0;
+    if (p < last && *p == '.') {
+        const char* frac_start = p + 1;
+        const char* q = frac_start;
+        for (; q < last && frac_digits < INT_DECIMALS && *q >= '0' && *q <= '9'; ++q, ++frac_digits) {
+            frac_part = frac_part * 10 + static_cast<uint64_t>(*q - '0');
+        }
+        // A point with no digits on either side is not part of a number
+        if (int_digits + frac_digits > 0) {
+            p = q;
+        }
+    }
+
+    if (int_digits + frac_digits == 0) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    for (size_t i = frac_digits; i < INT_DECIMALS; ++i) {
+        frac_part *= 10;
+    }
+    if (overflow || int_part > (UINT64_MAX - frac_part) / INTS_PER_INT) {
+        return {p, std::errc::result_out_of_range};
+    }
+
+    ints = int_part * INTS_PER_INT + frac_part;
+    return {p, std::errc()};
+}
+
+size_t FormatAmounts(const uint64_t* amounts, size_t count, char* out, size_t slot_size,
+                     const AmountFormat& format) {
+    if (slot_size < MAX_AMOUNT_CHARS + 1) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        char* slot = out + i * slot_size;
+        size_t len = FormatMagnitude(slot, false, amounts[i], format);
+        slot[len] = '\0';
+    }
+    return count;
+}
+
+size_t FormatSignedAmounts(const int64_t* amounts, size_t count, char* out, size_t slot_size,
+                           const AmountFormat& format) {
+    if (slot_size < MAX_AMOUNT_CHARS + 1) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        int64_t amount = amounts[i];
+        bool negative = amount < 0;
+        uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(amount) : static_cast<uint64_t>(amount);
+
+        char* slot = out + i * slot_size;
+        size_t len = FormatMagnitude(slot, negative, magnitude, format);
+        slot[len] = '\0';
+    }
+    return count;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,647 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_broadcast_queue.h>
+#include <intcoin/mobile_raw_tx.h>
+#include <intcoin/mobile_trace.h>
+#include <intcoin/util.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+constexpr char JOURNAL_MAGIC[8] = {'I', 'N', 'T', 'B', 'C', 'A', 'S', 'T'};
+constexpr uint32_t JOURNAL_VERSION = 1;
+
+constexpr uint8_t RECORD_ADD = 1;   // Transaction queued (raw bytes follow)
+constexpr uint8_t RECORD_DONE = 2;  // Transaction acknowledged or expired
+
+#pragma pack(push, 1)
+struct JournalHeader {
+    char magic[8];
+    uint32_t version;
+};
+
+struct JournalRecord {
+    uint8_t type;
+    uint8_t tx_hash[32];
+    int64_t queued_unix_ms;
+    uint32_t length;  // Raw transaction bytes following (0 for RECORD_DONE)
+};
+#pragma pack(pop)
+
+/// Compact once this many stale records have built up
+constexpr size_t JOURNAL_COMPACT_SLACK = 64;
+
+int64_t UnixMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+double MillisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool WriteAll(int fd, const void* data, size_t size) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+std::string ShortHash(const uint256& hash) {
+    return BytesToHex(std::vector<uint8_t>(hash.begin(), hash.end())).substr(0, 16);
+}
+
+}  // namespace
+
+// ========================================
+// Transports
+// ========================================
+
+SPVBroadcastTransport::SPVBroadcastTransport(ClientProvider provider)
+    : provider_(std::move(provider)) {
+}
+
+size_t SPVBroadcastTransport::GetPeerCount() const {
+    auto spv_client = provider_();
+    return spv_client && spv_client->GetPeerCount() > 0 ? 1 : 0;
+}
+
+Result<void> SPVBroadcastTransport::Relay(size_t /*peer_index*/, const std::vector<uint8_t>& raw_tx) {
+    auto spv_client = provider_();
+    if (!spv_client) {
+        return Result<void>::Error("SPV not enabled");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return spv_client->BroadcastTransaction(raw_tx);
+}
+
+LoopbackTransport::LoopbackTransport(std::vector<Peer> peers, uint64_t seed)
+    : peers_(std::move(peers)), online_(peers_.size(), true), rng_(seed) {
+}
+
+Result<void> LoopbackTransport::Relay(size_t peer_index, const std::vector<uint8_t>& raw_tx) {
+    if (peer_index >= peers_.size() || raw_tx.empty()) {
+        return Result<void>::Error("Invalid relay");
+    }
+
+    std::this_thread::sleep_for(peers_[peer_index].latency);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!online_[peer_index]) {
+        return Result<void>::Error("Peer " + std::to_string(peer_index) + " offline");
+    }
+    if (std::bernoulli_distribution(peers_[peer_index].failure_rate)(rng_)) {
+        return Result<void>::Error("Peer " + std::to_string(peer_index) + " refused");
+    }
+    ++accepted_;
+    return Result<void>::Ok();
+}
+
+void LoopbackTransport::SetPeerOnline(size_t peer_index, bool online) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (peer_index < online_.size()) {
+        online_[peer_index] = online;
+    }
+}
+
+uint64_t LoopbackTransport::GetAcceptedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return accepted_;
+}
+
+// ========================================
+// Broadcast Queue
+// ========================================
+
+/// One fan-out attempt, shared with the lanes relaying it
+/// A lane may still be relaying after the attempt timed out, so the
+/// attempt lives as long as any lane holds it.
+struct BroadcastQueue::Attempt {
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t outstanding = 0;
+    bool acknowledged = false;
+    bool cancelled = false;
+    std::string last_error;
+};
+
+BroadcastQueue::BroadcastQueue(const BroadcastQueueConfig& config,
+                               std::shared_ptr<BroadcastTransport> transport,
+                               MemoryAccount* memory)
+    : config_(config), transport_(std::move(transport)), memory_(memory),
+      entries_(TrackedAllocator<Entry>(memory)), rng_(std::random_device{}()) {
+}
+
+BroadcastQueue::~BroadcastQueue() {
+    Stop();
+    if (journal_fd_ >= 0) {
+        ::close(journal_fd_);
+    }
+}
+
+Result<void> BroadcastQueue::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return Result<void>::Ok();
+    }
+
+    if (!config_.journal_path.empty()) {
+        auto load_result = LoadJournal();
+        if (load_result.IsError()) {
+            return load_result;
+        }
+        auto compact_result = CompactJournal();
+        if (compact_result.IsError()) {
+            return compact_result;
+        }
+    }
+
+    running_ = true;
+    size_t lanes = std::max<size_t>(config_.fanout, 1);
+    lane_jobs_.assign(lanes, LaneJob());
+    for (size_t lane = 0; lane < lanes; ++lane) {
+        lanes_.emplace_back([this, lane] { LaneLoop(lane); });
+    }
+    worker_ = std::thread([this] { WorkerLoop(); });
+
+    LogF(LogLevel::INFO, "Mobile SDK: Broadcast queue started (%zu pending)", entries_.size());
+
+    return Result<void>::Ok();
+}
+
+void BroadcastQueue::Stop() {
+    std::shared_ptr<Attempt> attempt;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        attempt = current_attempt_;
+    }
+
+    if (attempt) {
+        std::lock_guard<std::mutex> attempt_lock(attempt->mutex);
+        attempt->cancelled = true;
+        attempt->cv.notify_all();
+    }
+    wake_cv_.notify_all();
+    lane_cv_.notify_all();
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    for (auto& lane : lanes_) {
+        lane.join();
+    }
+    lanes_.clear();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    lane_jobs_.clear();
+    if (journal_fd_ >= 0) {
+        ::close(journal_fd_);
+        journal_fd_ = -1;
+    }
+}
+
+Result<uint256> BroadcastQueue::Enqueue(std::vector<uint8_t> raw_tx) {
+    auto view_result = RawTransactionView::Parse(raw_tx.data(), raw_tx.size());
+    if (view_result.IsError()) {
+        return Result<uint256>::Error("Invalid transaction: " + view_result.error);
+    }
+    return Enqueue(std::move(raw_tx), view_result.GetValue());
+}
+
+Result<uint256> BroadcastQueue::Enqueue(std::vector<uint8_t> raw_tx, const RawTransactionView& view) {
+    // Moving a vector keeps its buffer, so a view over the caller's bytes
+    // still points at them here
+    if (view.GetData() != raw_tx.data() || view.GetSize() != raw_tx.size()) {
+        return Result<uint256>::Error("Invalid transaction: view is not over these bytes");
+    }
+
+    Entry entry;
+    entry.tx_hash = view.GetHash();
+    entry.raw_tx = MakeTrackedBuffer(std::move(raw_tx), memory_);
+    entry.queued_unix_ms = UnixMillis();
+    entry.queued_at = Clock::now();
+    entry.next_attempt = entry.queued_at;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& queued : entries_) {
+        if (queued.tx_hash == entry.tx_hash) {
+            return Result<uint256>::Ok(entry.tx_hash);
+        }
+    }
+
+    // Durable before the caller is told the payment is queued; a journal
+    // lost to a failed compaction is reopened, and if it cannot be the
+    // send is refused rather than kept in memory only
+    if (!config_.journal_path.empty()) {
+        if (!EnsureJournalOpen()) {
+            return Result<uint256>::Error("Broadcast journal unavailable");
+        }
+        if (!AppendJournal(journal_fd_, RECORD_ADD, entry) || ::fsync(journal_fd_) != 0) {
+            return Result<uint256>::Error("Failed to journal transaction");
+        }
+    }
+
+    entries_.push_back(entry);
+    ++metrics_.enqueued;
+    wake_cv_.notify_all();
+
+    LogF(LogLevel::DEBUG, "Mobile SDK: Queued transaction %s for broadcast (%zu bytes)",
+         ShortHash(entry.tx_hash).c_str(), entry.raw_tx->size());
+
+    return Result<uint256>::Ok(entry.tx_hash);
+}
+
+void BroadcastQueue::RetryNow() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    for (auto& entry : entries_) {
+        entry.next_attempt = now;
+    }
+    wake_cv_.notify_all();
+}
+
+void BroadcastQueue::SetCompletionCallback(CompletionCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    completion_callback_ = std::move(callback);
+}
+
+bool BroadcastQueue::IsPending(const uint256& tx_hash) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::any_of(entries_.begin(), entries_.end(),
+                       [&](const Entry& entry) { return entry.tx_hash == tx_hash; });
+}
+
+size_t BroadcastQueue::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+BroadcastMetrics BroadcastQueue::GetMetrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    BroadcastMetrics metrics = metrics_;
+    metrics.pending = entries_.size();
+    return metrics;
+}
+
+void BroadcastQueue::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (running_) {
+        if (entries_.empty()) {
+            wake_cv_.wait(lock, [this] { return !running_ || !entries_.empty(); });
+            continue;
+        }
+
+        auto due = std::min_element(entries_.begin(), entries_.end(),
+                                    [](const Entry& a, const Entry& b) {
+                                        return a.next_attempt < b.next_attempt;
+                                    });
+        if (due->next_attempt > Clock::now()) {
+            wake_cv_.wait_until(lock, due->next_attempt);
+            continue;
+        }
+
+        auto expiry_ms = std::chrono::duration_cast<std::chrono::milliseconds>(config_.expiry).count();
+        if (UnixMillis() - due->queued_unix_ms > expiry_ms) {
+            LogF(LogLevel::WARNING, "Mobile SDK: Giving up on transaction %s after %u attempts",
+                 ShortHash(due->tx_hash).c_str(), due->attempts);
+            ++metrics_.expired;
+            Complete(due->tx_hash, false, lock);
+            continue;
+        }
+
+        // Nothing can go out without peers, so wait for some rather than
+        // spend an attempt (RetryNow wakes the queue when they connect)
+        if (!transport_ || transport_->GetPeerCount() == 0) {
+            due->next_attempt = Clock::now() + config_.initial_backoff;
+            continue;
+        }
+
+        if (due->attempts == 0) {
+            double first_relay_ms = MillisSince(due->queued_at);
+            total_first_relay_ms_ += first_relay_ms;
+            ++first_relays_;
+            metrics_.avg_first_relay_ms = total_first_relay_ms_ / static_cast<double>(first_relays_);
+            metrics_.max_first_relay_ms = std::max(metrics_.max_first_relay_ms, first_relay_ms);
+        }
+        ++due->attempts;
+        ++metrics_.attempts;
+
+        Entry entry = *due;
+        bool acknowledged = RelayToPeers(entry, lock);
+        if (!running_) {
+            break;
+        }
+
+        auto it = std::find_if(entries_.begin(), entries_.end(),
+                               [&](const Entry& e) { return e.tx_hash == entry.tx_hash; });
+        if (it == entries_.end()) {
+            continue;
+        }
+
+        if (acknowledged) {
+            double ack_ms = MillisSince(it->queued_at);
+            total_ack_ms_ += ack_ms;
+            ++metrics_.acknowledged;
+            metrics_.avg_ack_ms = total_ack_ms_ / static_cast<double>(metrics_.acknowledged);
+            metrics_.max_ack_ms = std::max(metrics_.max_ack_ms, ack_ms);
+
+            LogF(LogLevel::INFO, "Mobile SDK: Transaction %s acknowledged after %u attempt(s), %.0f ms",
+                 ShortHash(entry.tx_hash).c_str(), entry.attempts, ack_ms);
+            Complete(entry.tx_hash, true, lock);
+        } else {
+            ++metrics_.failed_attempts;
+            auto backoff = NextBackoff(it->attempts);
+            it->next_attempt = Clock::now() + backoff;
+
+            LogF(LogLevel::DEBUG, "Mobile SDK: Broadcast attempt %u for %s failed, retrying in %lld ms",
+                 it->attempts, ShortHash(entry.tx_hash).c_str(),
+                 static_cast<long long>(backoff.count()));
+        }
+    }
+}
+
+bool BroadcastQueue::RelayToPeers(const Entry& entry, std::unique_lock<std::mutex>& lock) {
+    size_t peers = transport_ ? transport_->GetPeerCount() : 0;
+    if (peers == 0) {
+        return false;
+    }
+
+    // A lane still waiting on a relay from an earlier attempt is skipped,
+    // so a hung peer holds one lane rather than gathering a thread per try
+    std::vector<size_t> idle_lanes;
+    for (size_t lane = 0; lane < lane_jobs_.size(); ++lane) {
+        if (!lane_jobs_[lane].attempt) {
+            idle_lanes.push_back(lane);
+        }
+    }
+    size_t lanes = std::min(idle_lanes.size(), peers);
+    if (lanes == 0) {
+        LogF(LogLevel::DEBUG, "Mobile SDK: Every relay lane is busy, %s waits",
+             ShortHash(entry.tx_hash).c_str());
+        return false;
+    }
+
+    TraceSpan span("send", "relay");
+    span.SetArg("peers", static_cast<int64_t>(lanes));
+
+    auto attempt = std::make_shared<Attempt>();
+    attempt->outstanding = lanes;
+
+    // Rotate through peers so retries reach ones not tried last time
+    for (size_t k = 0; k < lanes; ++k) {
+        LaneJob& job = lane_jobs_[idle_lanes[k]];
+        job.attempt = attempt;
+        job.raw_tx = entry.raw_tx;
+        job.peer = ((entry.attempts - 1) * lanes + k) % peers;
+    }
+    lane_cv_.notify_all();
+
+    current_attempt_ = attempt;
+    lock.unlock();
+
+    bool acknowledged;
+    {
+        std::unique_lock<std::mutex> attempt_lock(attempt->mutex);
+        attempt->cv.wait_for(attempt_lock, config_.attempt_timeout, [&] {
+            return attempt->acknowledged || attempt->outstanding == 0 || attempt->cancelled;
+        });
+        acknowledged = attempt->acknowledged;
+        if (!acknowledged && !attempt->last_error.empty()) {
+            LogF(LogLevel::DEBUG, "Mobile SDK: Relay of %s failed: %s",
+                 ShortHash(entry.tx_hash).c_str(), attempt->last_error.c_str());
+        }
+    }
+
+    lock.lock();
+    current_attempt_.reset();
+    return acknowledged;
+}
+
+void BroadcastQueue::LaneLoop(size_t lane) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;) {
+        lane_cv_.wait(lock, [&] { return !running_ || lane_jobs_[lane].attempt; });
+        if (!running_) {
+            return;
+        }
+
+        LaneJob job = lane_jobs_[lane];
+        lock.unlock();
+
+        auto result = transport_->Relay(job.peer, *job.raw_tx);
+        {
+            std::lock_guard<std::mutex> attempt_lock(job.attempt->mutex);
+            if (result.IsOk()) {
+                job.attempt->acknowledged = true;
+            } else {
+                job.attempt->last_error = result.error;
+            }
+            --job.attempt->outstanding;
+            job.attempt->cv.notify_all();
+        }
+
+        lock.lock();
+        lane_jobs_[lane] = LaneJob();
+    }
+}
+
+std::chrono::milliseconds BroadcastQueue::NextBackoff(uint32_t attempts) {
+    uint32_t doublings = std::min<uint32_t>(attempts > 0 ? attempts - 1 : 0, 20);
+    std::chrono::milliseconds base = std::min<std::chrono::milliseconds>(
+        config_.initial_backoff * (int64_t{1} << doublings), config_.max_backoff);
+
+    // Spread retries over [base/2, base] so many clients do not retry in step
+    auto half = base.count() / 2;
+    std::uniform_int_distribution<long long> jitter(0, half);
+    return std::chrono::milliseconds(base.count() - half + jitter(rng_));
+}
+
+void BroadcastQueue::Complete(const uint256& tx_hash, bool acknowledged,
+                              std::unique_lock<std::mutex>& lock) {
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [&](const Entry& e) { return e.tx_hash == tx_hash; });
+    if (it == entries_.end()) {
+        return;
+    }
+
+    // Not synced: losing this record only means one extra relay after restart
+    if (journal_fd_ >= 0) {
+        AppendJournal(journal_fd_, RECORD_DONE, *it);
+    }
+    entries_.erase(it);
+
+    if (journal_fd_ >= 0 && journal_records_ > 2 * entries_.size() + JOURNAL_COMPACT_SLACK) {
+        auto compact_result = CompactJournal();
+        if (compact_result.IsError()) {
+            LogF(LogLevel::WARNING, "Mobile SDK: Broadcast journal compaction failed: %s",
+                 compact_result.error.c_str());
+        }
+    }
+
+    // Run the callback unlocked so it may call back into the queue
+    CompletionCallback callback = completion_callback_;
+    if (callback) {
+        lock.unlock();
+        callback(tx_hash, acknowledged);
+        lock.lock();
+    }
+}
+
+// ========================================
+// Journal
+// ========================================
+
+Result<void> BroadcastQueue::LoadJournal() {
+    std::ifstream file(config_.journal_path, std::ios::binary);
+    if (!file) {
+        return Result<void>::Ok();  // Nothing queued yet
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+
+    JournalHeader header;
+    if (data.size() < sizeof(header)) {
+        return Result<void>::Ok();
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 ||
+        header.version != JOURNAL_VERSION) {
+        return Result<void>::Error("Unrecognised broadcast journal");
+    }
+
+    auto now = Clock::now();
+    size_t pos = sizeof(header);
+    size_t dropped = 0;
+
+    // A record cut short by a crash ends the journal
+    while (data.size() - pos >= sizeof(JournalRecord)) {
+        JournalRecord record;
+        std::memcpy(&record, data.data() + pos, sizeof(record));
+        pos += sizeof(record);
+        if (data.size() - pos < record.length) {
+            break;
+        }
+
+        uint256 tx_hash;
+        std::memcpy(tx_hash.data(), record.tx_hash, sizeof(record.tx_hash));
+        auto existing = std::find_if(entries_.begin(), entries_.end(),
+                                     [&](const Entry& e) { return e.tx_hash == tx_hash; });
+
+        if (record.type == RECORD_ADD && existing == entries_.end()) {
+            std::vector<uint8_t> raw_tx(data.begin() + pos, data.begin() + pos + record.length);
+            auto view_result = RawTransactionView::Parse(raw_tx.data(), raw_tx.size());
+            if (view_result.IsOk() && view_result.GetValue().GetHash() == tx_hash) {
+                Entry entry;
+                entry.tx_hash = tx_hash;
+                entry.raw_tx = MakeTrackedBuffer(std::move(raw_tx), memory_);
+                entry.queued_unix_ms = record.queued_unix_ms;
+                entry.queued_at = now;
+                entry.next_attempt = now;
+                entries_.push_back(entry);
+            } else {
+                ++dropped;
+            }
+        } else if (record.type == RECORD_DONE && existing != entries_.end()) {
+            entries_.erase(existing);
+        }
+
+        pos += record.length;
+    }
+
+    if (dropped > 0) {
+        LogF(LogLevel::WARNING, "Mobile SDK: Dropped %zu corrupt broadcast journal record(s)", dropped);
+    }
+
+    return Result<void>::Ok();
+}
+
+Result<void> BroadcastQueue::CompactJournal() {
+    std::string tmp_path = config_.journal_path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return Result<void>::Error("Failed to create broadcast journal");
+    }
+
+    JournalHeader header;
+    std::memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    header.version = JOURNAL_VERSION;
+
+    bool ok = WriteAll(fd, &header, sizeof(header));
+    for (const auto& entry : entries_) {
+        ok = ok && AppendJournal(fd, RECORD_ADD, entry);
+    }
+    ok = ::fsync(fd) == 0 && ok;
+    ok = ::close(fd) == 0 && ok;
+
+    // Until the rename the old journal is complete and stays in use
+    if (!ok || std::rename(tmp_path.c_str(), config_.journal_path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return Result<void>::Error("Failed to write broadcast journal");
+    }
+
+    if (journal_fd_ >= 0) {
+        ::close(journal_fd_);
+        journal_fd_ = -1;
+    }
+    journal_records_ = entries_.size();
+    if (!EnsureJournalOpen()) {
+        return Result<void>::Error("Failed to open broadcast journal");
+    }
+
+    return Result<void>::Ok();
+}
+
+bool BroadcastQueue::EnsureJournalOpen() {
+    if (journal_fd_ < 0) {
+        journal_fd_ = ::open(config_.journal_path.c_str(), O_WRONLY | O_APPEND);
+    }
+    return journal_fd_ >= 0;
+}
+
+bool BroadcastQueue::AppendJournal(int fd, uint8_t type, const Entry& entry) {
+    JournalRecord record;
+    record.type = type;
+    std::memcpy(record.tx_hash, entry.tx_hash.data(), sizeof(record.tx_hash));
+    record.queued_unix_ms = entry.queued_unix_ms;
+    record.length = type == RECORD_ADD ? static_cast<uint32_t>(entry.raw_tx->size()) : 0;
+
+    bool ok = WriteAll(fd, &record, sizeof(record)) &&
+              (record.length == 0 || WriteAll(fd, entry.raw_tx->data(), record.length));
+    if (fd == journal_fd_) {
+        ++journal_records_;
+    }
+    return ok;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,44 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_chain_tip.h>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+/// Reads of the client before settling for a possibly torn tip
+constexpr int MAX_TIP_READS = 3;
+
+}  // namespace
+
+ChainTip ReadChainTip(const std::shared_ptr<SPVClient>& spv_client) {
+    ChainTip tip;
+    if (!spv_client) {
+        return tip;
+    }
+
+    for (int attempt = 0; attempt < MAX_TIP_READS; ++attempt) {
+        uint256 hash_before = spv_client->GetBestHash();
+        tip.height = spv_client->GetBestHeight();
+        tip.hash = spv_client->GetBestHash();
+        if (tip.hash == hash_before) {
+            break;
+        }
+    }
+    return tip;
+}
+
+ChainTip CaptureChainTip(const ChainTipPublisher* publisher,
+                         const std::shared_ptr<SPVClient>& spv_client) {
+    if (publisher) {
+        if (auto tip = publisher->Get()) {
+            return *tip;
+        }
+    }
+    return ReadChainTip(spv_client);
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,360 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_coin_selection.h>
+#include <intcoin/util.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+/// Upper bound on branch-and-bound search steps
+constexpr size_t BNB_MAX_TRIES = 100000;
+
+/// Knapsack subset approximation passes
+constexpr size_t KNAPSACK_ITERATIONS = 1000;
+
+/// Steps between deadline checks
+constexpr size_t DEADLINE_CHECK_INTERVAL = 1024;
+
+using Clock = std::chrono::steady_clock;
+
+/// Coin with its value net of the fee needed to spend it
+struct Candidate {
+    size_t index;        // Into SortedUTXOIndex::GetCoins()
+    uint64_t effective;  // amount - input fee
+};
+
+struct SelectionContext {
+    const CoinSelectionParams& params;
+    std::vector<Candidate> candidates;  // Descending effective value
+    uint64_t input_fee;
+    uint64_t fee_no_change;             // Fixed part of the fee without change
+    uint64_t fee_with_change;           // Fixed part of the fee with change
+    uint64_t min_change;
+    Clock::time_point deadline;
+};
+
+uint64_t RateFee(size_t size, uint64_t fee_rate) {
+    return (size * fee_rate) / 1000;
+}
+
+/// Depth-first search for an input set whose effective value lands in
+/// [target, target + cost_of_change], so no change output is needed
+bool SelectBranchAndBound(const SelectionContext& ctx, std::vector<size_t>& best) {
+    const auto& cands = ctx.candidates;
+    const size_t n = cands.size();
+    const uint64_t target = ctx.params.target + ctx.fee_no_change;
+    const uint64_t cost_of_change = ctx.fee_with_change - ctx.fee_no_change + ctx.min_change;
+
+    std::vector<uint64_t> remaining(n + 1, 0);
+    for (size_t i = n; i-- > 0;) {
+        remaining[i] = remaining[i + 1] + cands[i].effective;
+    }
+    if (remaining[0] < target) {
+        return false;
+    }
+
+    std::vector<size_t> included;
+    uint64_t current = 0;
+    uint64_t best_excess = std::numeric_limits<uint64_t>::max();
+    size_t i = 0;
+
+    for (size_t tries = 0; tries < BNB_MAX_TRIES; ++tries) {
+        if (tries % DEADLINE_CHECK_INTERVAL == 0 && Clock::now() > ctx.deadline) {
+            break;
+        }
+
+        bool backtrack = false;
+        if (current + remaining[i] < target || current > target + cost_of_change) {
+            backtrack = true;
+        } else if (current >= target) {
+            uint64_t excess = current - target;
+            if (excess < best_excess) {
+                best_excess = excess;
+                best = included;
+                if (excess == 0) {
+                    break;
+                }
+            }
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            if (included.empty()) {
+                break;  // Search space exhausted
+            }
+
+            // Explore the branch that omits the last included coin, skipping
+            // successors of equal value which would repeat the same sums
+            size_t last = included.back();
+            included.pop_back();
+            current -= cands[last].effective;
+            i = last + 1;
+            while (i < n && cands[i].effective == cands[last].effective) {
+                ++i;
+            }
+            continue;
+        }
+
+        included.push_back(i);
+        current += cands[i].effective;
+        ++i;
+    }
+
+    return !best.empty();
+}
+
+/// Randomised approximation of the smallest subset reaching the target,
+/// compared against the single smallest coin that covers it alone
+bool SelectKnapsack(const SelectionContext& ctx, std::vector<size_t>& best) {
+    const auto& cands = ctx.candidates;
+    const uint64_t exact_target = ctx.params.target + ctx.fee_no_change;
+    const uint64_t target = ctx.params.target + ctx.fee_with_change + ctx.min_change;
+
+    // A single coin that pays exactly without change
+    for (size_t i = 0; i < cands.size(); ++i) {
+        if (cands[i].effective == exact_target) {
+            best = {i};
+            return true;
+        }
+    }
+
+    std::vector<size_t> smaller;
+    uint64_t sum_smaller = 0;
+    size_t lowest_larger = cands.size();
+    for (size_t i = 0; i < cands.size(); ++i) {
+        if (cands[i].effective < target) {
+            smaller.push_back(i);
+            sum_smaller += cands[i].effective;
+        } else {
+            lowest_larger = i;  // Descending order, so the last one is the smallest
+        }
+    }
+
+    if (sum_smaller == target) {
+        best = smaller;
+        return true;
+    }
+
+    if (sum_smaller < target) {
+        if (lowest_larger == cands.size()) {
+            return false;
+        }
+        best = {lowest_larger};
+        return true;
+    }
+
+    // Fixed seed keeps selection reproducible for a given UTXO set
+    std::mt19937_64 rng(ctx.params.target ^ (static_cast<uint64_t>(smaller.size()) << 32));
+    std::vector<bool> included(smaller.size());
+    std::vector<bool> best_included(smaller.size(), true);
+    uint64_t best_total = sum_smaller;
+
+    for (size_t rep = 0; rep < KNAPSACK_ITERATIONS && best_total != target; ++rep) {
+        if (rep % 64 == 0 && Clock::now() > ctx.deadline) {
+            break;
+        }
+
+        std::fill(included.begin(), included.end(), false);
+        uint64_t total = 0;
+        bool reached = false;
+
+        // First pass picks coins at random, second pass fills in the rest
+        for (int pass = 0; pass < 2 && !reached; ++pass) {
+            for (size_t i = 0; i < smaller.size(); ++i) {
+                bool take = (pass == 0) ? (rng() & 1) : !included[i];
+                if (!take) {
+                    continue;
+                }
+                total += cands[smaller[i]].effective;
+                included[i] = true;
+                if (total >= target) {
+                    reached = true;
+                    if (total < best_total) {
+                        best_total = total;
+                        best_included = included;
+                    }
+                    total -= cands[smaller[i]].effective;
+                    included[i] = false;
+                }
+            }
+        }
+    }
+
+    if (lowest_larger != cands.size() &&
+        (best_total < target || cands[lowest_larger].effective <= best_total)) {
+        best = {lowest_larger};
+        return true;
+    }
+
+    best.clear();
+    for (size_t i = 0; i < smaller.size(); ++i) {
+        if (best_included[i]) {
+            best.push_back(smaller[i]);
+        }
+    }
+    return best_total >= target;
+}
+
+/// Take coins in descending order until the payment and change are covered
+bool SelectLargestFirst(const SelectionContext& ctx, std::vector<size_t>& best) {
+    const uint64_t target = ctx.params.target + ctx.fee_with_change;
+
+    uint64_t total = 0;
+    best.clear();
+    for (size_t i = 0; i < ctx.candidates.size() && total < target; ++i) {
+        best.push_back(i);
+        total += ctx.candidates[i].effective;
+    }
+    if (total < target) {
+        // Pay without change if that is all the wallet can do
+        return total >= ctx.params.target + ctx.fee_no_change;
+    }
+    return true;
+}
+
+/// Turn candidate positions into a result with final fee and change
+Result<CoinSelectionResult> Finalize(const SortedUTXOIndex& index,
+                                     const SelectionContext& ctx,
+                                     const std::vector<size_t>& selected,
+                                     CoinSelectionStrategy strategy) {
+    CoinSelectionResult result;
+    result.strategy = strategy;
+    for (size_t pos : selected) {
+        const auto& coin = index.GetCoins()[ctx.candidates[pos].index];
+        result.coins.push_back(coin);
+        result.total_in += coin.amount;
+    }
+
+    const auto& params = ctx.params;
+    size_t size_with_change = EstimateTransactionSize(result.coins.size(), params.num_outputs + 1);
+    uint64_t fee_with_change = FeeForSize(size_with_change, params.fee_rate);
+
+    if (result.total_in >= params.target + fee_with_change + ctx.min_change) {
+        result.fee = fee_with_change;
+        result.change = result.total_in - params.target - fee_with_change;
+        result.tx_size = size_with_change;
+        return Result<CoinSelectionResult>::Ok(result);
+    }
+
+    // Change would be uneconomical; the excess goes to the fee
+    size_t size_no_change = EstimateTransactionSize(result.coins.size(), params.num_outputs);
+    uint64_t fee_no_change = FeeForSize(size_no_change, params.fee_rate);
+    if (result.total_in < params.target + fee_no_change) {
+        return Result<CoinSelectionResult>::Error("Insufficient funds for fee");
+    }
+
+    result.fee = result.total_in - params.target;
+    result.change = 0;
+    result.tx_size = size_no_change;
+    return Result<CoinSelectionResult>::Ok(result);
+}
+
+}  // namespace
+
+SortedUTXOIndex::SortedUTXOIndex(std::vector<TxInputCoin> coins)
+    : coins_(std::move(coins)) {
+    std::sort(coins_.begin(), coins_.end(), [](const TxInputCoin& a, const TxInputCoin& b) {
+        return a.amount > b.amount;
+    });
+
+    prefix_sums_.reserve(coins_.size());
+    uint64_t total = 0;
+    for (const auto& coin : coins_) {
+        total += coin.amount;
+        prefix_sums_.push_back(total);
+    }
+}
+
+size_t SortedUTXOIndex::EstimateInputCount(uint64_t amount) const {
+    auto it = std::lower_bound(prefix_sums_.begin(), prefix_sums_.end(), amount);
+    if (it == prefix_sums_.end()) {
+        return coins_.size();
+    }
+    return static_cast<size_t>(it - prefix_sums_.begin()) + 1;
+}
+
+Result<CoinSelectionResult> SelectCoins(const SortedUTXOIndex& index,
+                                        const CoinSelectionParams& params) {
+    if (params.target == 0) {
+        return Result<CoinSelectionResult>::Error("Amount must be positive");
+    }
+    if (index.GetTotal() < params.target) {
+        return Result<CoinSelectionResult>::Error("Insufficient balance");
+    }
+
+    const uint64_t input_fee = RateFee(TX_INPUT_SIZE, params.fee_rate);
+
+    SelectionContext ctx{params, {}, input_fee,
+                         RateFee(EstimateTransactionSize(0, params.num_outputs), params.fee_rate),
+                         RateFee(EstimateTransactionSize(0, params.num_outputs + 1), params.fee_rate),
+                         params.min_change > 0 ? params.min_change : std::max(input_fee, MIN_TX_FEE),
+                         Clock::now() + params.time_budget};
+
+    // Coins worth less than their own input fee never help
+    ctx.candidates.reserve(index.Size());
+    for (size_t i = 0; i < index.Size(); ++i) {
+        uint64_t amount = index.GetCoins()[i].amount;
+        if (amount > input_fee) {
+            ctx.candidates.push_back({i, amount - input_fee});
+        }
+    }
+
+    std::vector<CoinSelectionStrategy> order;
+    if (params.strategy == CoinSelectionStrategy::AUTO) {
+        order = {CoinSelectionStrategy::BRANCH_AND_BOUND,
+                 CoinSelectionStrategy::KNAPSACK,
+                 CoinSelectionStrategy::LARGEST_FIRST};
+    } else {
+        order = {params.strategy};
+    }
+
+    for (auto strategy : order) {
+        std::vector<size_t> selected;
+        bool found = false;
+        switch (strategy) {
+        case CoinSelectionStrategy::BRANCH_AND_BOUND:
+            found = SelectBranchAndBound(ctx, selected);
+            break;
+        case CoinSelectionStrategy::KNAPSACK:
+            found = SelectKnapsack(ctx, selected);
+            break;
+        case CoinSelectionStrategy::LARGEST_FIRST:
+        case CoinSelectionStrategy::AUTO:
+            found = SelectLargestFirst(ctx, selected);
+            break;
+        }
+
+        if (found) {
+            // The minimum fee can still reject a selection made on effective values
+            auto result = Finalize(index, ctx, selected, strategy);
+            if (result.IsOk()) {
+                return result;
+            }
+        }
+    }
+
+    LogF(LogLevel::DEBUG, "Mobile SDK: %s coin selection found no solution for %llu INTS",
+         CoinSelectionStrategyName(params.strategy), params.target);
+
+    return Result<CoinSelectionResult>::Error("Insufficient funds for fee");
+}
+
+const char* CoinSelectionStrategyName(CoinSelectionStrategy strategy) {
+    switch (strategy) {
+    case CoinSelectionStrategy::AUTO: return "auto";
+    case CoinSelectionStrategy::BRANCH_AND_BOUND: return "branch-and-bound";
+    case CoinSelectionStrategy::KNAPSACK: return "knapsack";
+    case CoinSelectionStrategy::LARGEST_FIRST: return "largest-first";
+    }
+    return "unknown";
+}
+
+}  // namespace mobile
+}  // namespace intcoin
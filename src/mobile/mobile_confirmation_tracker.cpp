@@ -0,0 +1,148 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_confirmation_tracker.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace intcoin {
+namespace mobile {
+
+size_t ConfirmationTracker::Uint256Hasher::operator()(const uint256& hash) const {
+    // Transaction hashes are uniformly distributed already
+    size_t value;
+    std::memcpy(&value, hash.data(), sizeof(value));
+    return value;
+}
+
+ConfirmationTracker::ConfirmationTracker(std::vector<uint32_t> depths, MemoryAccount* memory)
+    : depths_(std::move(depths)),
+      pending_(0, Uint256Hasher(), std::equal_to<uint256>(),
+               TrackedAllocator<std::pair<const uint256, Pending>>(memory)) {
+    depths_.erase(std::remove(depths_.begin(), depths_.end(), 0u), depths_.end());
+    std::sort(depths_.begin(), depths_.end());
+    depths_.erase(std::unique(depths_.begin(), depths_.end()), depths_.end());
+    if (depths_.empty()) {
+        depths_.push_back(1);
+    }
+}
+
+void ConfirmationTracker::Track(const uint256& tx_hash, uint64_t amount_ints) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& pending = pending_[tx_hash];
+    pending.amount_ints = amount_ints;
+}
+
+void ConfirmationTracker::Untrack(const uint256& tx_hash) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.erase(tx_hash);
+}
+
+bool ConfirmationTracker::Advance(const uint256& tx_hash, Pending& pending, uint64_t tip_height,
+                                  std::vector<ConfirmationUpdate>* updates) const {
+    if (pending.block_height == 0 || pending.block_height > tip_height) {
+        return false;
+    }
+
+    // One update per depth crossed, e.g. 1, 3 and 6 after catching up
+    uint64_t confirmations = tip_height - pending.block_height + 1;
+    while (pending.next_depth < depths_.size() && confirmations >= depths_[pending.next_depth]) {
+        uint32_t depth = depths_[pending.next_depth];
+        ++pending.next_depth;
+        updates->push_back({tx_hash, pending.amount_ints, depth, pending.next_depth == depths_.size()});
+    }
+
+    return pending.next_depth == depths_.size();
+}
+
+std::vector<ConfirmationUpdate> ConfirmationTracker::BlockConnected(
+    uint64_t height, const std::vector<uint256>& matched_txids) {
+    std::vector<ConfirmationUpdate> updates;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& txid : matched_txids) {
+        auto it = pending_.find(txid);
+        if (it != pending_.end() && it->second.block_height == 0) {
+            it->second.block_height = height;
+        }
+    }
+
+    for (auto it = pending_.begin(); it != pending_.end();) {
+        if (Advance(it->first, it->second, height, &updates)) {
+            it = pending_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    return updates;
+}
+
+std::vector<ConfirmationUpdate> ConfirmationTracker::BlockDisconnected(uint64_t height) {
+    std::vector<ConfirmationUpdate> updates;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& [txid, pending] : pending_) {
+        if (pending.block_height != 0 && pending.block_height >= height) {
+            pending.block_height = 0;
+            pending.next_depth = 0;
+            updates.push_back({txid, pending.amount_ints, 0, false});
+        }
+    }
+
+    return updates;
+}
+
+std::vector<ConfirmationUpdate> ConfirmationTracker::Refresh(uint64_t tip_height,
+                                                             const BlockHeightFn& block_height) {
+    std::vector<uint256> txids;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        txids.reserve(pending_.size());
+        for (const auto& entry : pending_) {
+            txids.push_back(entry.first);
+        }
+    }
+
+    // The lookup may be slow (it reads the wallet), so it runs unlocked
+    std::vector<uint64_t> heights(txids.size());
+    for (size_t i = 0; i < txids.size(); ++i) {
+        heights[i] = block_height(txids[i]);
+    }
+
+    std::vector<ConfirmationUpdate> updates;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t i = 0; i < txids.size(); ++i) {
+        auto it = pending_.find(txids[i]);
+        if (it == pending_.end()) {
+            continue;
+        }
+        Pending& pending = it->second;
+
+        // Mined somewhere else, or not at all any more, after a reorg
+        if (pending.block_height != 0 && pending.block_height != heights[i]) {
+            pending.next_depth = 0;
+            updates.push_back({it->first, pending.amount_ints, 0, false});
+        }
+        pending.block_height = heights[i];
+
+        if (Advance(it->first, pending, tip_height, &updates)) {
+            pending_.erase(it);
+        }
+    }
+
+    return updates;
+}
+
+size_t ConfirmationTracker::GetTrackedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+}  // namespace mobile
+}  // namespace intcoin
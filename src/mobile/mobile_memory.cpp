@@ -0,0 +1,117 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_memory.h>
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+/// Adopted buffer plus the charge it releases when the last owner goes
+struct ChargedBuffer {
+    std::vector<uint8_t> bytes;
+    MemoryAccount* account;
+    size_t charged;
+
+    ChargedBuffer(std::vector<uint8_t> buffer, MemoryAccount* memory)
+        : bytes(std::move(buffer)), account(memory), charged(bytes.capacity()) {
+        if (account && charged > 0) {
+            account->Allocated(charged);
+        }
+    }
+
+    ~ChargedBuffer() {
+        if (account && charged > 0) {
+            account->Freed(charged);
+        }
+    }
+
+    ChargedBuffer(const ChargedBuffer&) = delete;
+    ChargedBuffer& operator=(const ChargedBuffer&) = delete;
+};
+
+}  // namespace
+
+const char* MemorySubsystemName(MemorySubsystem subsystem) {
+    switch (subsystem) {
+        case MemorySubsystem::BLOOM_FILTER: return "bloom_filter";
+        case MemorySubsystem::UTXO_SET: return "utxo_set";
+        case MemorySubsystem::HISTORY: return "history";
+        case MemorySubsystem::ADDRESS_BOOK: return "address_book";
+        case MemorySubsystem::PENDING_QUEUES: return "pending_queues";
+        case MemorySubsystem::COUNT: break;
+    }
+    return "unknown";
+}
+
+// ========================================
+// MemoryAccount
+// ========================================
+
+void MemoryAccount::Allocated(size_t bytes) {
+    uint64_t now = bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    blocks_.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t peak = peak_bytes_.load(std::memory_order_relaxed);
+    while (now > peak && !peak_bytes_.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+    }
+}
+
+void MemoryAccount::Freed(size_t bytes) {
+    bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    blocks_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<const std::vector<uint8_t>> MakeTrackedBuffer(std::vector<uint8_t> bytes,
+                                                              MemoryAccount* account) {
+    // The control block is charged through the allocator, the adopted bytes by ChargedBuffer
+    auto holder = std::allocate_shared<ChargedBuffer>(TrackedAllocator<ChargedBuffer>(account),
+                                                      std::move(bytes), account);
+    return std::shared_ptr<const std::vector<uint8_t>>(holder, &holder->bytes);
+}
+
+// ========================================
+// MemoryUsage
+// ========================================
+
+uint64_t MemoryUsage::GetTotalBytes() const {
+    uint64_t total = 0;
+    for (const auto& subsystem : subsystems) {
+        total += subsystem.bytes;
+    }
+    return total;
+}
+
+void MemoryTracker::AddTo(MemoryUsage* usage) const {
+    for (size_t i = 0; i < MEMORY_SUBSYSTEM_COUNT; ++i) {
+        usage->subsystems[i].bytes += accounts_[i].GetBytes();
+        usage->subsystems[i].peak_bytes += accounts_[i].GetPeakBytes();
+        usage->subsystems[i].blocks += accounts_[i].GetBlocks();
+    }
+}
+
+std::string FormatMemoryUsageJSON(const MemoryUsage& usage) {
+    std::string out;
+    out.reserve(512);
+
+    char field[160];
+    std::snprintf(field, sizeof(field), "{\"total_bytes\":%" PRIu64, usage.GetTotalBytes());
+    out += field;
+    for (size_t i = 0; i < MEMORY_SUBSYSTEM_COUNT; ++i) {
+        const MemorySubsystemUsage& subsystem = usage.subsystems[i];
+        std::snprintf(field, sizeof(field),
+                      ",\"%s\":{\"bytes\":%" PRIu64 ",\"peak_bytes\":%" PRIu64 ",\"blocks\":%" PRIu64 "}",
+                      MemorySubsystemName(static_cast<MemorySubsystem>(i)), subsystem.bytes,
+                      subsystem.peak_bytes, subsystem.blocks);
+        out += field;
+    }
+    out += "}";
+    return out;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,305 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_payment_uri.h>
+#include <intcoin/mobile_amount.h>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+/// Suffix written into amounts by SDK versions before percent-encoding
+constexpr std::string_view LEGACY_AMOUNT_SUFFIX = " INT";
+
+constexpr std::string_view AMOUNT_KEY = "amount";
+constexpr std::string_view LABEL_KEY = "label";
+constexpr std::string_view MESSAGE_KEY = "message";
+constexpr std::string_view REQUIRED_PREFIX = "req-";
+
+bool IsAlnum(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool IsUnreserved(char c) {
+    return IsAlnum(c) || c == '-' || c == '.' || c == '_' || c == '~';
+}
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool IsValidAddressText(std::string_view address) {
+    if (address.empty()) {
+        return false;
+    }
+    for (char c : address) {
+        if (!IsAlnum(c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SchemeMatches(std::string_view uri) {
+    if (uri.size() < PAYMENT_URI_SCHEME.size()) {
+        return false;
+    }
+    // Schemes are case-insensitive (RFC 3986 section 3.1)
+    for (size_t i = 0; i < PAYMENT_URI_SCHEME.size(); ++i) {
+        char c = uri[i];
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        if (c != PAYMENT_URI_SCHEME[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Write an amount in INT, dropping trailing fractional zeros
+/// @param out Buffer of at least MAX_AMOUNT_CHARS bytes
+/// @return Characters written
+size_t FormatAmount(uint64_t ints, char* out) {
+    AmountFormat format;
+    format.trim_zeros = true;
+    return static_cast<size_t>(AmountToChars(out, out + MAX_AMOUNT_CHARS, ints, format).ptr - out);
+}
+
+/// Parse a whole amount in INT with up to six decimals
+bool ParseAmount(std::string_view text, uint64_t* ints) {
+    const char* last = text.data() + text.size();
+    auto [end, ec] = AmountFromChars(text.data(), last, *ints);
+    return ec == std::errc() && end == last;
+}
+
+/// Appends to a fixed buffer; the builder checks the total size up front
+class Writer {
+public:
+    explicit Writer(char* out) : out_(out) {}
+
+    void Put(std::string_view text) {
+        for (char c : text) {
+            out_[len_++] = c;
+        }
+    }
+
+    void PutEncoded(std::string_view text) {
+        for (char c : text) {
+            if (IsUnreserved(c)) {
+                out_[len_++] = c;
+            } else {
+                auto byte = static_cast<unsigned char>(c);
+                out_[len_++] = '%';
+                out_[len_++] = HEX_DIGITS[byte >> 4];
+                out_[len_++] = HEX_DIGITS[byte & 0x0F];
+            }
+        }
+    }
+
+    char* Tail() { return out_ + len_; }
+    void Advance(size_t count) { len_ += count; }
+    size_t Size() const { return len_; }
+
+private:
+    char* out_;
+    size_t len_ = 0;
+};
+
+}  // namespace
+
+size_t PercentEncodedSize(std::string_view in) {
+    size_t size = 0;
+    for (char c : in) {
+        size += IsUnreserved(c) ? 1 : 3;
+    }
+    return size;
+}
+
+Result<size_t> PercentEncode(std::string_view in, char* out, size_t out_size) {
+    size_t size = PercentEncodedSize(in);
+    if (size > out_size) {
+        return Result<size_t>::Error("Buffer too small");
+    }
+    Writer writer(out);
+    writer.PutEncoded(in);
+    return Result<size_t>::Ok(size);
+}
+
+Result<size_t> PercentDecode(std::string_view in, char* out, size_t out_size) {
+    size_t len = 0;
+    for (size_t i = 0; i < in.size(); ++i) {
+        char c = in[i];
+        if (c == '%') {
+            if (in.size() - i < 3) {
+                return Result<size_t>::Error("Truncated percent escape");
+            }
+            int hi = HexValue(in[i + 1]);
+            int lo = HexValue(in[i + 2]);
+            if (hi < 0 || lo < 0) {
+                return Result<size_t>::Error("Invalid percent escape");
+            }
+            c = static_cast<char>((hi << 4) | lo);
+            i += 2;
+        }
+        if (len == out_size) {
+            return Result<size_t>::Error("Buffer too small");
+        }
+        out[len++] = c;
+    }
+    return Result<size_t>::Ok(len);
+}
+
+size_t PaymentURISize(std::string_view address, uint64_t amount_ints,
+                      std::string_view label, std::string_view message) {
+    size_t size = PAYMENT_URI_SCHEME.size() + address.size();
+    if (amount_ints > 0) {
+        char amount[MAX_AMOUNT_CHARS];
+        size += 2 + AMOUNT_KEY.size() + FormatAmount(amount_ints, amount);
+    }
+    if (!label.empty()) {
+        size += 2 + LABEL_KEY.size() + PercentEncodedSize(label);
+    }
+    if (!message.empty()) {
+        size += 2 + MESSAGE_KEY.size() + PercentEncodedSize(message);
+    }
+    return size;
+}
+
+Result<size_t> BuildPaymentURI(char* out, size_t out_size,
+                               std::string_view address, uint64_t amount_ints,
+                               std::string_view label, std::string_view message) {
+    if (!IsValidAddressText(address)) {
+        return Result<size_t>::Error("Invalid address");
+    }
+    if (PaymentURISize(address, amount_ints, label, message) >= out_size) {
+        return Result<size_t>::Error("Buffer too small");
+    }
+
+    Writer writer(out);
+    writer.Put(PAYMENT_URI_SCHEME);
+    writer.Put(address);
+
+    char separator = '?';
+    auto put_key = [&](std::string_view key) {
+        writer.Put(std::string_view(&separator, 1));
+        writer.Put(key);
+        writer.Put("=");
+        separator = '&';
+    };
+
+    if (amount_ints > 0) {
+        put_key(AMOUNT_KEY);
+        writer.Advance(FormatAmount(amount_ints, writer.Tail()));
+    }
+    if (!label.empty()) {
+        put_key(LABEL_KEY);
+        writer.PutEncoded(label);
+    }
+    if (!message.empty()) {
+        put_key(MESSAGE_KEY);
+        writer.PutEncoded(message);
+    }
+
+    out[writer.Size()] = '\0';
+    return Result<size_t>::Ok(writer.Size());
+}
+
+Result<PaymentURIView> ParsePaymentURI(std::string_view uri, char* scratch, size_t scratch_size) {
+    if (!SchemeMatches(uri)) {
+        return Result<PaymentURIView>::Error("Invalid URI scheme");
+    }
+
+    std::string_view rest = uri.substr(PAYMENT_URI_SCHEME.size());
+    size_t query_start = rest.find('?');
+
+    PaymentURIView view;
+    view.address = rest.substr(0, query_start);
+    if (!IsValidAddressText(view.address)) {
+        return Result<PaymentURIView>::Error("Invalid address in URI");
+    }
+    if (query_start == std::string_view::npos) {
+        return Result<PaymentURIView>::Ok(view);
+    }
+
+    std::string_view query = rest.substr(query_start + 1);
+    size_t scratch_used = 0;
+    bool seen_amount = false;
+    bool seen_label = false;
+    bool seen_message = false;
+
+    auto decode_into_scratch = [&](std::string_view value, std::string_view* field) {
+        auto decoded = PercentDecode(value, scratch + scratch_used, scratch_size - scratch_used);
+        if (decoded.IsError()) {
+            return false;
+        }
+        *field = std::string_view(scratch + scratch_used, decoded.GetValue());
+        scratch_used += decoded.GetValue();
+        return true;
+    };
+
+    while (!query.empty()) {
+        size_t amp_pos = query.find('&');
+        std::string_view param = query.substr(0, amp_pos);
+        query = amp_pos == std::string_view::npos ? std::string_view() : query.substr(amp_pos + 1);
+
+        if (param.empty()) {
+            continue;
+        }
+
+        size_t eq_pos = param.find('=');
+        std::string_view key = param.substr(0, eq_pos);
+        std::string_view value = eq_pos == std::string_view::npos ? std::string_view()
+                                                                  : param.substr(eq_pos + 1);
+
+        if (key == AMOUNT_KEY) {
+            if (seen_amount) {
+                return Result<PaymentURIView>::Error("Duplicate amount in URI");
+            }
+            seen_amount = true;
+
+            char amount[MAX_AMOUNT_CHARS];
+            auto decoded = PercentDecode(value, amount, sizeof(amount));
+            if (decoded.IsError()) {
+                return Result<PaymentURIView>::Error("Invalid amount in URI");
+            }
+            std::string_view text(amount, decoded.GetValue());
+            if (text.size() > LEGACY_AMOUNT_SUFFIX.size() &&
+                text.substr(text.size() - LEGACY_AMOUNT_SUFFIX.size()) == LEGACY_AMOUNT_SUFFIX) {
+                text.remove_suffix(LEGACY_AMOUNT_SUFFIX.size());
+            }
+            if (!ParseAmount(text, &view.amount_ints)) {
+                return Result<PaymentURIView>::Error("Invalid amount in URI");
+            }
+        } else if (key == LABEL_KEY) {
+            if (seen_label) {
+                return Result<PaymentURIView>::Error("Duplicate label in URI");
+            }
+            seen_label = true;
+            if (!decode_into_scratch(value, &view.label)) {
+                return Result<PaymentURIView>::Error("Invalid label in URI");
+            }
+        } else if (key == MESSAGE_KEY) {
+            if (seen_message) {
+                return Result<PaymentURIView>::Error("Duplicate message in URI");
+            }
+            seen_message = true;
+            if (!decode_into_scratch(value, &view.message)) {
+                return Result<PaymentURIView>::Error("Invalid message in URI");
+            }
+        } else if (key.substr(0, REQUIRED_PREFIX.size()) == REQUIRED_PREFIX) {
+            return Result<PaymentURIView>::Error("Unsupported required parameter in URI");
+        }
+    }
+
+    return Result<PaymentURIView>::Ok(view);
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,544 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_payout_import.h>
+#include <intcoin/mobile_amount.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+/// Bytes per file read
+constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+/// Rows per validation slice, so small chunks are not spread thin
+constexpr size_t MIN_SLICE_ROWS = 256;
+
+bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+std::string_view Trim(std::string_view text) {
+    while (!text.empty() && IsSpace(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && IsSpace(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+/// Trim a CSV field and drop surrounding quotes
+std::string_view CSVField(std::string_view field) {
+    field = Trim(field);
+    if (field.size() >= 2 && field.front() == '"' && field.back() == '"') {
+        field = Trim(field.substr(1, field.size() - 2));
+    }
+    return field;
+}
+
+/// Read a JSON string starting at the opening quote
+/// @return False if unterminated or using an escape payouts never need
+bool ReadJSONString(const std::string& text, size_t* pos, std::string* out) {
+    out->clear();
+    for (size_t i = *pos + 1; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '"') {
+            *pos = i + 1;
+            return true;
+        }
+        if (c == '\\') {
+            if (++i == text.size()) {
+                return false;
+            }
+            switch (text[i]) {
+                case '"': c = '"'; break;
+                case '\\': c = '\\'; break;
+                case '/': c = '/'; break;
+                case 't': c = '\t'; break;
+                case 'n': c = '\n'; break;
+                case 'r': c = '\r'; break;
+                default: return false;
+            }
+        }
+        out->push_back(c);
+    }
+    return false;
+}
+
+/// Skip a JSON value starting at pos, keeping scalars
+/// @return False if malformed
+bool ReadJSONValue(const std::string& text, size_t* pos, std::string* scalar) {
+    scalar->clear();
+    char first = text[*pos];
+    if (first == '"') {
+        return ReadJSONString(text, pos, scalar);
+    }
+
+    if (first == '{' || first == '[') {
+        // Nested values carry nothing a payout needs
+        int depth = 0;
+        bool in_string = false;
+        for (size_t i = *pos; i < text.size(); ++i) {
+            char c = text[i];
+            if (in_string) {
+                if (c == '\\') {
+                    ++i;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == '{' || c == '[') {
+                ++depth;
+            } else if ((c == '}' || c == ']') && --depth == 0) {
+                *pos = i + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t end = *pos;
+    while (end < text.size() && text[end] != ',' && text[end] != '}' && !IsSpace(text[end])) {
+        ++end;
+    }
+    if (end == *pos) {
+        return false;
+    }
+    scalar->assign(text, *pos, end - *pos);
+    *pos = end;
+    return true;
+}
+
+void SkipSpace(const std::string& text, size_t* pos) {
+    while (*pos < text.size() && IsSpace(text[*pos])) {
+        ++*pos;
+    }
+}
+
+/// FNV-1a over the lower-cased address
+uint64_t AddressHash(std::string_view address) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : address) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/// FNV-1a step over raw bytes
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+constexpr char RESUME_MAGIC[8] = {'I', 'N', 'T', 'P', 'A', 'I', 'D', '1'};
+
+}  // namespace
+
+// ========================================
+// PayoutFileReader
+// ========================================
+
+Result<std::unique_ptr<PayoutFileReader>> PayoutFileReader::Open(const std::string& path,
+                                                                 PayoutFileFormat format) {
+    using OpenResult = Result<std::unique_ptr<PayoutFileReader>>;
+
+    std::unique_ptr<PayoutFileReader> reader(new PayoutFileReader());
+    reader->file_.open(path, std::ios::binary);
+    if (!reader->file_) {
+        return OpenResult::Error("Failed to open payout file: " + path);
+    }
+
+    reader->file_.seekg(0, std::ios::end);
+    reader->file_size_ = static_cast<uint64_t>(reader->file_.tellg());
+    reader->file_.seekg(0, std::ios::beg);
+
+    reader->buffer_.resize(READ_BUFFER_SIZE);
+    reader->file_.read(reader->buffer_.data(), static_cast<std::streamsize>(reader->buffer_.size()));
+    reader->buffer_len_ = static_cast<size_t>(reader->file_.gcount());
+    reader->eof_ = reader->buffer_len_ < reader->buffer_.size();
+
+    // Skip a UTF-8 byte order mark, as spreadsheet exports often start with one
+    if (reader->buffer_len_ >= 3 && std::string_view(reader->buffer_.data(), 3) == "\xEF\xBB\xBF") {
+        reader->buffer_pos_ = 3;
+        reader->bytes_read_ = 3;
+    }
+
+    if (format == PayoutFileFormat::AUTO) {
+        format = PayoutFileFormat::CSV;
+        for (size_t i = reader->buffer_pos_; i < reader->buffer_len_; ++i) {
+            char c = reader->buffer_[i];
+            if (!IsSpace(c)) {
+                if (c == '[' || c == '{') {
+                    format = PayoutFileFormat::JSON;
+                }
+                break;
+            }
+        }
+    }
+    reader->format_ = format;
+
+    return OpenResult::Ok(std::move(reader));
+}
+
+bool PayoutFileReader::NextByte(char* c) {
+    if (buffer_pos_ == buffer_len_) {
+        if (eof_) {
+            return false;
+        }
+        file_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_len_ = static_cast<size_t>(file_.gcount());
+        buffer_pos_ = 0;
+        eof_ = buffer_len_ < buffer_.size();
+        if (buffer_len_ == 0) {
+            return false;
+        }
+    }
+
+    *c = buffer_[buffer_pos_++];
+    ++bytes_read_;
+    if (*c == '\n') {
+        ++line_;
+    }
+    return true;
+}
+
+bool PayoutFileReader::NextLine(std::string* line, uint64_t* line_number, bool* too_long) {
+    line->clear();
+    *line_number = line_;
+    *too_long = false;
+
+    char c;
+    bool any = false;
+    while (NextByte(&c)) {
+        any = true;
+        if (c == '\n') {
+            break;
+        }
+        if (line->size() < MAX_PAYOUT_RECORD_SIZE) {
+            line->push_back(c);
+        } else {
+            *too_long = true;
+        }
+    }
+    if (!line->empty() && line->back() == '\r') {
+        line->pop_back();
+    }
+    return any;
+}
+
+Result<bool> PayoutFileReader::NextObject(std::string* object, uint64_t* line_number, bool* too_long) {
+    object->clear();
+    *too_long = false;
+
+    // Find the start of the next object, past the array brackets and commas
+    char c;
+    for (;;) {
+        if (!NextByte(&c)) {
+            return Result<bool>::Ok(false);
+        }
+        if (c == '{') {
+            break;
+        }
+        if (!IsSpace(c) && c != ',' && c != '[' && c != ']') {
+            return Result<bool>::Error("Malformed JSON at line " + std::to_string(line_));
+        }
+    }
+
+    *line_number = line_;
+    object->push_back(c);
+
+    int depth = 1;
+    bool in_string = false;
+    bool escaped = false;
+    while (depth > 0) {
+        if (!NextByte(&c)) {
+            return Result<bool>::Error("Unterminated JSON object at line " + std::to_string(*line_number));
+        }
+        if (object->size() < MAX_PAYOUT_RECORD_SIZE) {
+            object->push_back(c);
+        } else {
+            *too_long = true;
+        }
+
+        if (in_string) {
+            if (escaped) {
+                escaped = false;
+            } else if (c == '\\') {
+                escaped = true;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            --depth;
+        }
+    }
+
+    return Result<bool>::Ok(true);
+}
+
+void PayoutFileReader::ParseCSVLine(const std::string& line, PayoutRow* row) const {
+    std::string_view text(line);
+    size_t comma = text.find(',');
+    row->address = std::string(CSVField(text.substr(0, comma)));
+    if (row->address.empty()) {
+        row->error = "Missing address";
+        return;
+    }
+    if (comma == std::string_view::npos) {
+        row->error = "Missing amount";
+        return;
+    }
+
+    std::string_view rest = text.substr(comma + 1);
+    row->amount = std::string(CSVField(rest.substr(0, rest.find(','))));
+    if (row->amount.empty()) {
+        row->error = "Missing amount";
+    }
+}
+
+void PayoutFileReader::ParseJSONObject(const std::string& object, PayoutRow* row) const {
+    size_t pos = 1;
+    std::string key;
+    std::string value;
+
+    for (;;) {
+        SkipSpace(object, &pos);
+        if (pos < object.size() && object[pos] == '}') {
+            break;
+        }
+        if (pos >= object.size() || object[pos] != '"' || !ReadJSONString(object, &pos, &key)) {
+            row->error = "Malformed JSON object";
+            return;
+        }
+        SkipSpace(object, &pos);
+        if (pos >= object.size() || object[pos] != ':') {
+            row->error = "Malformed JSON object";
+            return;
+        }
+        ++pos;
+        SkipSpace(object, &pos);
+        if (pos >= object.size() || !ReadJSONValue(object, &pos, &value)) {
+            row->error = "Malformed JSON object";
+            return;
+        }
+
+        if (key == "address") {
+            row->address = value;
+        } else if (key == "amount") {
+            row->amount = value;
+        }
+
+        SkipSpace(object, &pos);
+        if (pos < object.size() && object[pos] == ',') {
+            ++pos;
+        } else if (pos >= object.size() || object[pos] != '}') {
+            row->error = "Malformed JSON object";
+            return;
+        }
+    }
+
+    if (row->address.empty()) {
+        row->error = "Missing address";
+    } else if (row->amount.empty()) {
+        row->error = "Missing amount";
+    }
+}
+
+Result<size_t> PayoutFileReader::Read(size_t max_rows, std::vector<PayoutRow>* rows) {
+    rows->clear();
+    std::string record;
+    bool too_long = false;
+
+    while (rows->size() < max_rows) {
+        PayoutRow row;
+
+        if (format_ == PayoutFileFormat::JSON) {
+            auto next = NextObject(&record, &row.line, &too_long);
+            if (next.IsError()) {
+                return Result<size_t>::Error(next.error);
+            }
+            if (!next.GetValue()) {
+                break;
+            }
+            if (too_long) {
+                row.error = "Record too long";
+            } else {
+                ParseJSONObject(record, &row);
+            }
+        } else {
+            if (!NextLine(&record, &row.line, &too_long)) {
+                break;
+            }
+            std::string_view text = Trim(record);
+            if (text.empty() || text.front() == '#') {
+                continue;
+            }
+            if (too_long) {
+                row.error = "Record too long";
+            } else {
+                ParseCSVLine(record, &row);
+
+                // A first row whose amount is not a number is a header
+                if (!header_checked_) {
+                    header_checked_ = true;
+                    char first = row.amount.empty() ? '\0' : row.amount.front();
+                    if (!(first >= '0' && first <= '9') && first != '.') {
+                        continue;
+                    }
+                }
+            }
+        }
+
+        header_checked_ = true;
+        rows->push_back(std::move(row));
+    }
+
+    return Result<size_t>::Ok(rows->size());
+}
+
+// ========================================
+// Validation
+// ========================================
+
+void ValidatePayoutRows(std::vector<PayoutRow>* rows, AddressNetwork network, WorkerPool* pool) {
+    const size_t count = rows->size();
+    if (count == 0) {
+        return;
+    }
+
+    size_t slices = 1;
+    if (pool) {
+        slices = std::max<size_t>(1, std::min(pool->GetLaneCount() * 4, count / MIN_SLICE_ROWS));
+    }
+
+    auto run_slice = [&](size_t slice) {
+        size_t begin = count * slice / slices;
+        size_t end = count * (slice + 1) / slices;
+
+        std::vector<std::string_view> addresses;
+        std::vector<size_t> indices;
+        addresses.reserve(end - begin);
+        indices.reserve(end - begin);
+
+        for (size_t i = begin; i < end; ++i) {
+            PayoutRow& row = (*rows)[i];
+            if (!row.error.empty()) {
+                continue;
+            }
+
+            const char* last = row.amount.data() + row.amount.size();
+            auto [ptr, ec] = AmountFromChars(row.amount.data(), last, row.amount_ints);
+            if (ec != std::errc() || ptr != last) {
+                row.amount_ints = 0;
+            }
+            if (ec == std::errc::result_out_of_range) {
+                row.error = "Amount out of range";
+                continue;
+            }
+            if (ec != std::errc() || ptr != last) {
+                row.error = "Invalid amount";
+                continue;
+            }
+            if (row.amount_ints == 0) {
+                row.error = "Amount must be positive";
+                continue;
+            }
+
+            addresses.push_back(row.address);
+            indices.push_back(i);
+        }
+
+        std::vector<AddressError> errors(addresses.size());
+        ValidateAddresses(addresses.data(), addresses.size(), errors.data(), network);
+        for (size_t j = 0; j < errors.size(); ++j) {
+            if (errors[j] != AddressError::OK) {
+                (*rows)[indices[j]].error = std::string("Invalid address: ") + AddressErrorString(errors[j]);
+            }
+        }
+    };
+
+    if (slices > 1) {
+        pool->ParallelFor(slices, run_slice);
+    } else {
+        run_slice(0);
+    }
+}
+
+bool PayoutDeduplicator::Insert(std::string_view address) {
+    // A collision rejects a payout that was not a repeat; it is reported
+    // like any other rejection, so nothing is paid twice either way
+    return seen_.insert(AddressHash(address)).second;
+}
+
+// ========================================
+// Resume
+// ========================================
+
+uint64_t PayoutFingerprint(uint64_t fingerprint, const PayoutRow& row) {
+    fingerprint = HashBytes(fingerprint, &row.line, sizeof(row.line));
+    fingerprint = HashBytes(fingerprint, row.address.data(), row.address.size() + 1);
+    return HashBytes(fingerprint, &row.amount_ints, sizeof(row.amount_ints));
+}
+
+Result<PayoutResumePoint> LoadPayoutResumePoint(const std::string& path) {
+    PayoutResumePoint point;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return Result<PayoutResumePoint>::Ok(point);
+    }
+
+    char magic[sizeof(RESUME_MAGIC)];
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, RESUME_MAGIC, sizeof(magic)) != 0 ||
+        !file.read(reinterpret_cast<char*>(&point), sizeof(point))) {
+        return Result<PayoutResumePoint>::Error("Unreadable payout resume file " + path);
+    }
+    return Result<PayoutResumePoint>::Ok(point);
+}
+
+Result<void> SavePayoutResumePoint(const std::string& path, const PayoutResumePoint& point) {
+    std::string tmp_path = path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return Result<void>::Error("Failed to create payout resume file " + path);
+    }
+
+    char record[sizeof(RESUME_MAGIC) + sizeof(point)];
+    std::memcpy(record, RESUME_MAGIC, sizeof(RESUME_MAGIC));
+    std::memcpy(record + sizeof(RESUME_MAGIC), &point, sizeof(point));
+    bool ok = ::write(fd, record, sizeof(record)) == static_cast<ssize_t>(sizeof(record)) &&
+              ::fsync(fd) == 0;
+    ::close(fd);
+
+    // A crash leaves the old record or the new one, never half of either
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return Result<void>::Error("Failed to write payout resume file " + path);
+    }
+    return Result<void>::Ok();
+}
+
+}  // namespace mobile
+}  // namespace intcoin
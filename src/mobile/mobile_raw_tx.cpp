@@ -0,0 +1,192 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_raw_tx.h>
+#include <intcoin/crypto.h>
+
+#include <cstring>
+#include <string>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+/// Smallest possible input: prev hash + index + two empty fields + sequence
+constexpr size_t MIN_INPUT_SIZE = 32 + 4 + 1 + 1 + 4;
+
+/// Smallest possible output: value + empty script
+constexpr size_t MIN_OUTPUT_SIZE = 8 + 1;
+
+/// Bounds-checked cursor over the raw bytes
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : pos_(data), end_(data + size) {}
+
+    size_t Remaining() const { return static_cast<size_t>(end_ - pos_); }
+
+    bool ReadLE32(uint32_t& value) {
+        if (Remaining() < 4) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(pos_[i]) << (8 * i);
+        }
+        pos_ += 4;
+        return true;
+    }
+
+    bool ReadLE64(uint64_t& value) {
+        if (Remaining() < 8) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(pos_[i]) << (8 * i);
+        }
+        pos_ += 8;
+        return true;
+    }
+
+    /// Compact size, rejecting non-canonical encodings
+    bool ReadCompactSize(uint64_t& value) {
+        if (Remaining() < 1) {
+            return false;
+        }
+        uint8_t prefix = *pos_++;
+        if (prefix < 253) {
+            value = prefix;
+            return true;
+        }
+
+        size_t width = prefix == 253 ? 2 : (prefix == 254 ? 4 : 8);
+        if (Remaining() < width) {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < width; ++i) {
+            value |= static_cast<uint64_t>(pos_[i]) << (8 * i);
+        }
+        pos_ += width;
+
+        uint64_t min_value = prefix == 253 ? 253 : (prefix == 254 ? 0x10000 : 0x100000000ULL);
+        return value >= min_value;
+    }
+
+    bool Skip(uint64_t count) {
+        if (Remaining() < count) {
+            return false;
+        }
+        pos_ += count;
+        return true;
+    }
+
+    /// Compact-size length followed by that many bytes
+    bool SkipVarBytes() {
+        uint64_t length;
+        return ReadCompactSize(length) && Skip(length);
+    }
+
+private:
+    const uint8_t* pos_;
+    const uint8_t* end_;
+};
+
+}  // namespace
+
+Result<RawTransactionView> RawTransactionView::Parse(const uint8_t* data, size_t size) {
+    using ViewResult = Result<RawTransactionView>;
+
+    if (!data || size == 0) {
+        return ViewResult::Error("Empty transaction");
+    }
+    if (size > MAX_RAW_TX_SIZE) {
+        return ViewResult::Error("Transaction too large");
+    }
+
+    RawTransactionView view;
+    Reader reader(data, size);
+
+    if (!reader.ReadLE32(view.version_)) {
+        return ViewResult::Error("Truncated version");
+    }
+
+    uint64_t input_count;
+    if (!reader.ReadCompactSize(input_count)) {
+        return ViewResult::Error("Bad input count");
+    }
+    if (input_count == 0) {
+        return ViewResult::Error("Transaction has no inputs");
+    }
+    if (input_count > reader.Remaining() / MIN_INPUT_SIZE) {
+        return ViewResult::Error("Input count exceeds transaction size");
+    }
+
+    for (uint64_t i = 0; i < input_count; ++i) {
+        // Outpoint, signature, public key, sequence
+        if (!reader.Skip(32 + 4) || !reader.SkipVarBytes() ||
+            !reader.SkipVarBytes() || !reader.Skip(4)) {
+            return ViewResult::Error("Truncated input " + std::to_string(i));
+        }
+    }
+
+    uint64_t output_count;
+    if (!reader.ReadCompactSize(output_count)) {
+        return ViewResult::Error("Bad output count");
+    }
+    if (output_count == 0) {
+        return ViewResult::Error("Transaction has no outputs");
+    }
+    if (output_count > reader.Remaining() / MIN_OUTPUT_SIZE) {
+        return ViewResult::Error("Output count exceeds transaction size");
+    }
+
+    for (uint64_t i = 0; i < output_count; ++i) {
+        uint64_t value;
+        if (!reader.ReadLE64(value) || !reader.SkipVarBytes()) {
+            return ViewResult::Error("Truncated output " + std::to_string(i));
+        }
+        if (view.total_output_ + value < view.total_output_) {
+            return ViewResult::Error("Output values overflow");
+        }
+        view.total_output_ += value;
+    }
+
+    if (!reader.ReadLE32(view.locktime_)) {
+        return ViewResult::Error("Truncated locktime");
+    }
+    if (reader.Remaining() != 0) {
+        return ViewResult::Error("Trailing bytes after transaction");
+    }
+
+    view.data_ = data;
+    view.size_ = size;
+    view.input_count_ = static_cast<size_t>(input_count);
+    view.output_count_ = static_cast<size_t>(output_count);
+    view.hash_ = SHA3::Hash(data, size);
+
+    return ViewResult::Ok(view);
+}
+
+Result<void> CheckViewMatchesCore(const RawTransactionView& view, const Transaction& tx) {
+    if (tx.inputs.size() != view.GetInputCount() || tx.outputs.size() != view.GetOutputCount() ||
+        tx.version != view.GetVersion() || tx.locktime != view.GetLocktime()) {
+        return Result<void>::Error("Transaction fields differ from the core's reading");
+    }
+
+    std::vector<uint8_t> serialized = tx.Serialize();
+    if (serialized.size() != view.GetSize() ||
+        std::memcmp(serialized.data(), view.GetData(), serialized.size()) != 0) {
+        return Result<void>::Error("Transaction does not round-trip through the core serializer");
+    }
+
+    if (tx.GetHash() != view.GetHash()) {
+        return Result<void>::Error("Transaction hash differs from the core's txid");
+    }
+
+    return Result<void>::Ok();
+}
+
+}  // namespace mobile
+}  // namespace intcoin
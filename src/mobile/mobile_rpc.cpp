@@ -2,14 +2,29 @@
 // Distributed under the MIT software license
 
 #include <intcoin/mobile_rpc.h>
+#include <intcoin/mobile_address_index.h>
+#include <intcoin/mobile_chain_tip.h>
+#include <intcoin/mobile_raw_tx.h>
+#include <intcoin/mobile_rpc_context.h>
+#include <intcoin/mobile_rpc_metrics.h>
 #include <intcoin/util.h>
 
 #include <algorithm>
+#include <cassert>
 #include <chrono>
 
 namespace intcoin {
 namespace mobile {
 
+namespace {
+
+/// Tip for one request: the calling SDK's published tip, else the client's
+ChainTip RequestTip(const std::shared_ptr<SPVClient>& spv_client) {
+    return CaptureChainTip(RPCContextScope::Current().chain_tip, spv_client);
+}
+
+}  // namespace
+
 MobileRPC::MobileRPC(std::shared_ptr<SPVClient> spv_client,
                      std::shared_ptr<wallet::Wallet> wallet)
     : spv_client_(spv_client), wallet_(wallet) {
@@ -18,11 +33,19 @@ MobileRPC::MobileRPC(std::shared_ptr<SPVClient> spv_client,
 }
 
 Result<SyncResponse> MobileRPC::Sync(const SyncRequest& request) {
+    RPCCallScope call(RPCMethod::SYNC);
     SyncResponse response;
 
+    if (!spv_client_) {
+        return Result<SyncResponse>::Error("SPV client not open");
+    }
+
     // Set bloom filter on SPV client
     spv_client_->SetBloomFilter(request.filter);
 
+    // One tip for the whole response
+    ChainTip tip = RequestTip(spv_client_);
+
     // Get headers starting from last known block
     uint64_t start_height = 0;
     if (request.last_block_hash != uint256{}) {
@@ -30,13 +53,13 @@ Result<SyncResponse> MobileRPC::Sync(const SyncRequest& request) {
         if (header_result.IsOk()) {
             // Get height from header (need to track this)
             // For now, start from current height - max_headers
-            start_height = (spv_client_->GetBestHeight() > request.max_headers) ?
-                          (spv_client_->GetBestHeight() - request.max_headers) : 0;
+            start_height = (tip.height > request.max_headers) ?
+                          (tip.height - request.max_headers) : 0;
         }
     }
 
     // Get headers
-    uint64_t end_height = spv_client_->GetBestHeight();
+    uint64_t end_height = tip.height;
     uint64_t num_headers = std::min(static_cast<uint64_t>(request.max_headers),
                                    end_height - start_height + 1);
 
@@ -44,8 +67,8 @@ Result<SyncResponse> MobileRPC::Sync(const SyncRequest& request) {
                                                       start_height + num_headers - 1);
 
     // Set network status
-    response.best_height = spv_client_->GetBestHeight();
-    response.best_hash = spv_client_->GetBestHash();
+    response.best_height = tip.height;
+    response.best_hash = tip.hash;
 
     // Estimate fee rate from mempool if available, otherwise use sensible defaults
     // The mempool can provide accurate fee estimates based on current transaction backlog
@@ -61,10 +84,12 @@ Result<SyncResponse> MobileRPC::Sync(const SyncRequest& request) {
     LogF(LogLevel::INFO, "Mobile RPC: Sync returned %zu headers (height %llu)",
          response.headers.size(), response.best_height);
 
+    call.Succeeded(response.headers.size());
     return Result<SyncResponse>::Ok(response);
 }
 
 Result<BalanceResponse> MobileRPC::GetBalance(const BalanceRequest& request) {
+    RPCCallScope call(RPCMethod::GET_BALANCE);
     BalanceResponse response;
     response.confirmed_balance = 0;
     response.unconfirmed_balance = 0;
@@ -75,45 +100,124 @@ Result<BalanceResponse> MobileRPC::GetBalance(const BalanceRequest& request) {
     if (wallet_) {
         uint64_t confirmed = 0;
         uint64_t unconfirmed = 0;
+        uint32_t utxo_count = 0;
 
-        // Get wallet balance using wallet API
-        auto balance_result = wallet_->GetBalance();
-        if (balance_result.IsOk()) {
-            confirmed = *balance_result.value;
-        }
+        // Totals kept by the calling SDK's address index, if any
+        auto address_index = RPCContextScope::Current().address_index;
+
+        if (!request.address.empty()) {
+            auto hash_result = ScriptHashForAddress(request.address);
+            if (hash_result.IsError()) {
+                return Result<BalanceResponse>::Error("Invalid address: " + hash_result.error);
+            }
+
+            if (address_index) {
+                IndexedBalance balance = address_index->GetBalance(hash_result.GetValue());
+                confirmed = balance.confirmed;
+                unconfirmed = balance.unconfirmed;
+                utxo_count = balance.utxo_count;
+            } else {
+                auto utxos_result = wallet_->GetUTXOs();
+                if (utxos_result.IsOk()) {
+                    for (const auto& utxo : *utxos_result.value) {
+                        if (utxo.address != request.address) {
+                            continue;
+                        }
+                        (utxo.block_height != 0 ? confirmed : unconfirmed) += utxo.value;
+                        ++utxo_count;
+                    }
+                }
+            }
+        } else if (address_index) {
+            IndexedBalance balance = address_index->GetWalletBalance();
+            confirmed = balance.confirmed;
+            unconfirmed = balance.unconfirmed;
+            utxo_count = balance.utxo_count;
+        } else {
+            // Get wallet balance using wallet API
+            auto balance_result = wallet_->GetBalance();
+            if (balance_result.IsOk()) {
+                confirmed = *balance_result.value;
+            }
 
-        auto unconf_result = wallet_->GetUnconfirmedBalance();
-        if (unconf_result.IsOk()) {
-            unconfirmed = *unconf_result.value;
+            auto unconf_result = wallet_->GetUnconfirmedBalance();
+            if (unconf_result.IsOk()) {
+                unconfirmed = *unconf_result.value;
+            }
         }
 
         response.confirmed_balance = confirmed;
         response.unconfirmed_balance = unconfirmed;
         response.total_balance = confirmed + unconfirmed;
+        response.utxo_count = utxo_count;
 
         LogF(LogLevel::DEBUG, "Mobile RPC: Balance for %s: %llu INTS confirmed, %llu INTS unconfirmed",
-             request.address.c_str(), confirmed, unconfirmed);
+             request.address.empty() ? "wallet" : request.address.c_str(), confirmed, unconfirmed);
     } else {
         // No wallet available
         LogF(LogLevel::WARNING, "Mobile RPC: GetBalance called without wallet instance");
         return Result<BalanceResponse>::Error("Wallet not available");
     }
 
+    call.Succeeded(response.utxo_count);
     return Result<BalanceResponse>::Ok(response);
 }
 
 Result<HistoryResponse> MobileRPC::GetHistory(const HistoryRequest& request) {
+    RPCCallScope call(RPCMethod::GET_HISTORY);
+    if (request.page_size == 0) {
+        return Result<HistoryResponse>::Error("Page size must be at least 1");
+    }
+
     HistoryResponse response;
     response.entries = {};
     response.total_count = 0;
     response.page = request.page;
     response.total_pages = 0;
 
-    // Get transaction history from wallet if available
-    if (wallet_) {
+    // Per-address history comes from the address index, newest first
+    if (wallet_ && !request.address.empty()) {
+        auto hash_result = ScriptHashForAddress(request.address);
+        if (hash_result.IsError()) {
+            return Result<HistoryResponse>::Error("Invalid address: " + hash_result.error);
+        }
+
+        // Callers outside an SDK get an index built for this call
+        auto address_index = RPCContextScope::Current().address_index;
+        if (!address_index) {
+            address_index = AddressIndex::FromWallet(*wallet_);
+        }
+
+        size_t total_count = 0;
+        auto history = address_index->GetHistory(hash_result.GetValue(),
+                                                 static_cast<size_t>(request.page) * request.page_size,
+                                                 request.page_size, &total_count);
+        ChainTip tip = RequestTip(spv_client_);
+
+        for (const auto& indexed : history) {
+            HistoryEntry entry;
+            entry.tx_hash = indexed.tx_hash;
+            entry.amount_ints = indexed.delta_ints;
+            entry.confirmations = ConfirmationsAt(tip.height, indexed.block_height);
+            entry.timestamp = 0;
+            entry.is_incoming = indexed.delta_ints > 0;
+
+            // Only the page being returned is looked up
+            auto tx_result = wallet_->GetTransaction(indexed.tx_hash);
+            if (tx_result.IsOk()) {
+                entry.timestamp = tx_result.GetValue().timestamp;
+            }
+            response.entries.push_back(entry);
+        }
+
+        response.total_count = static_cast<uint32_t>(total_count);
+        response.total_pages = (response.total_count + request.page_size - 1) / request.page_size;
+    } else if (wallet_) {
+        // Get transaction history from wallet
         auto history_result = wallet_->GetTransactionHistory();
         if (history_result.IsOk()) {
             const auto& wallet_history = *history_result.value;
+            ChainTip tip = RequestTip(spv_client_);
 
             // Convert wallet history to mobile format with pagination
             size_t start_idx = request.page * request.page_size;
@@ -124,7 +228,7 @@ Result<HistoryResponse> MobileRPC::GetHistory(const HistoryRequest& request) {
                 HistoryEntry entry;
                 entry.tx_hash = tx_info.tx_hash;
                 entry.amount_ints = tx_info.amount;
-                entry.confirmations = GetConfirmations(tx_info.block_height);
+                entry.confirmations = ConfirmationsAt(tip.height, tx_info.block_height);
                 entry.timestamp = tx_info.timestamp;
                 entry.is_incoming = tx_info.is_incoming;
                 response.entries.push_back(entry);
@@ -136,28 +240,40 @@ Result<HistoryResponse> MobileRPC::GetHistory(const HistoryRequest& request) {
     }
 
     LogF(LogLevel::DEBUG, "Mobile RPC: GetHistory for %s (page %u, %zu entries)",
-         request.address.c_str(), request.page, response.entries.size());
+         request.address.empty() ? "wallet" : request.address.c_str(), request.page, response.entries.size());
 
+    call.Succeeded(response.entries.size());
     return Result<HistoryResponse>::Ok(response);
 }
 
 Result<SendTransactionResponse> MobileRPC::SendTransaction(const SendTransactionRequest& request) {
     SendTransactionResponse response;
 
-    // Deserialize transaction
-    auto tx_result = Transaction::Deserialize(request.raw_transaction);
-    if (tx_result.IsError()) {
+    // Validate structure and hash in place; the bytes are relayed as received
+    const auto& raw_tx = request.raw_transaction;
+
+    // Rejected transactions are reported in the response but count as errors
+    RPCCallScope call(RPCMethod::SEND_TRANSACTION, raw_tx.size());
+    auto view_result = RawTransactionView::Parse(raw_tx.data(), raw_tx.size());
+    if (view_result.IsError()) {
         response.accepted = false;
-        response.error = "Failed to deserialize transaction: " + tx_result.error;
+        response.error = "Invalid transaction: " + view_result.error;
         return Result<SendTransactionResponse>::Ok(response);
     }
 
-    Transaction tx = tx_result.GetValue();
-    response.tx_hash = tx.GetHash();
+    const RawTransactionView& view = view_result.GetValue();
+
+    // Debug builds confirm the view's reading of the layout matches the core's
+    assert([&]() {
+        auto tx_result = Transaction::Deserialize(raw_tx);
+        return tx_result.IsOk() && CheckViewMatchesCore(view, tx_result.GetValue()).IsOk();
+    }());
+
+    response.tx_hash = view.GetHash();
 
     // Broadcast transaction via SPV client which relays to connected peers
     if (spv_client_) {
-        auto broadcast_result = spv_client_->BroadcastTransaction(serialized_tx);
+        auto broadcast_result = spv_client_->BroadcastTransaction(raw_tx);
         if (broadcast_result.IsError()) {
             response.accepted = false;
             response.error = "Broadcast failed: " + broadcast_result.error;
@@ -173,48 +289,76 @@ Result<SendTransactionResponse> MobileRPC::SendTransaction(const SendTransaction
          BytesToHex(std::vector<uint8_t>(response.tx_hash.begin(),
                                          response.tx_hash.end())).substr(0, 16).c_str());
 
+    call.Succeeded(raw_tx.size());
     return Result<SendTransactionResponse>::Ok(response);
 }
 
 Result<UTXOResponse> MobileRPC::GetUTXOs(const UTXORequest& request) {
+    RPCCallScope call(RPCMethod::GET_UTXOS);
     UTXOResponse response;
     response.utxos = {};
     response.total_amount = 0;
 
     // Get UTXOs from wallet
     if (wallet_) {
-        auto utxos_result = wallet_->GetUTXOs();
-        if (utxos_result.IsOk()) {
-            const auto& wallet_utxos = *utxos_result.value;
-            uint64_t current_height = spv_client_ ? spv_client_->GetBestHeight() : 0;
-
-            for (const auto& utxo : wallet_utxos) {
-                // Filter by minimum confirmations
-                uint32_t confirmations = 0;
-                if (utxo.block_height > 0 && current_height >= utxo.block_height) {
-                    confirmations = static_cast<uint32_t>(current_height - utxo.block_height + 1);
-                }
+        ScriptHash script_hash{};
+        if (!request.address.empty()) {
+            auto hash_result = ScriptHashForAddress(request.address);
+            if (hash_result.IsError()) {
+                return Result<UTXOResponse>::Error("Invalid address: " + hash_result.error);
+            }
+            script_hash = hash_result.GetValue();
+        }
 
-                if (confirmations >= request.min_confirmations) {
-                    UTXO mobile_utxo;
-                    mobile_utxo.tx_hash = utxo.outpoint.tx_hash;
-                    mobile_utxo.output_index = utxo.outpoint.index;
-                    mobile_utxo.amount = utxo.value;
-                    mobile_utxo.confirmations = confirmations;
-                    response.utxos.push_back(mobile_utxo);
-                    response.total_amount += utxo.value;
+        ChainTip tip = RequestTip(spv_client_);
+
+        auto add_utxo = [&](const uint256& tx_hash, uint32_t output_index,
+                            uint64_t amount, uint64_t block_height) {
+            // Filter by minimum confirmations
+            uint32_t confirmations = ConfirmationsAt(tip.height, block_height);
+
+            if (confirmations >= request.min_confirmations) {
+                UTXO mobile_utxo;
+                mobile_utxo.tx_hash = tx_hash;
+                mobile_utxo.output_index = output_index;
+                mobile_utxo.amount = amount;
+                mobile_utxo.confirmations = confirmations;
+                response.utxos.push_back(mobile_utxo);
+                response.total_amount += amount;
+            }
+        };
+
+        // The index hands back only the coins asked for; without it, walk the wallet
+        if (auto address_index = RPCContextScope::Current().address_index) {
+            auto utxos = request.address.empty() ? address_index->GetWalletUTXOs()
+                                                 : address_index->GetUTXOs(script_hash);
+            response.utxos.reserve(utxos.size());
+            for (const auto& utxo : utxos) {
+                add_utxo(utxo.tx_hash, utxo.output_index, utxo.amount, utxo.block_height);
+            }
+        } else {
+            auto utxos_result = wallet_->GetUTXOs();
+            if (utxos_result.IsOk()) {
+                for (const auto& utxo : *utxos_result.value) {
+                    if (!request.address.empty() && utxo.address != request.address) {
+                        continue;
+                    }
+                    add_utxo(utxo.outpoint.tx_hash, utxo.outpoint.index, utxo.value, utxo.block_height);
                 }
             }
         }
     }
 
     LogF(LogLevel::DEBUG, "Mobile RPC: GetUTXOs for %s (min conf: %u, found: %zu)",
-         request.address.c_str(), request.min_confirmations, response.utxos.size());
+         request.address.empty() ? "wallet" : request.address.c_str(),
+         request.min_confirmations, response.utxos.size());
 
+    call.Succeeded(response.utxos.size());
     return Result<UTXOResponse>::Ok(response);
 }
 
 Result<FeeEstimateResponse> MobileRPC::EstimateFee(const FeeEstimateRequest& request) {
+    RPCCallScope call(RPCMethod::ESTIMATE_FEE, request.tx_size);
     FeeEstimateResponse response;
 
     // Fee estimation for INTcoin
@@ -252,18 +396,33 @@ Result<FeeEstimateResponse> MobileRPC::EstimateFee(const FeeEstimateRequest& req
     LogF(LogLevel::DEBUG, "Mobile RPC: Fee estimate for %u blocks: %llu INTS/KB, %llu INTS for %u bytes",
          request.target_blocks, response.fee_rate, response.estimated_fee, request.tx_size);
 
+    call.Succeeded(request.tx_size);
     return Result<FeeEstimateResponse>::Ok(response);
 }
 
 Result<MobileRPC::NetworkStatus> MobileRPC::GetNetworkStatus() {
     NetworkStatus status;
 
-    status.block_height = spv_client_->GetBestHeight();
-    status.block_hash = spv_client_->GetBestHash();
+    // Height and hash always describe the same block
+    ChainTip tip = RequestTip(spv_client_);
+    status.block_height = tip.height;
+    status.block_hash = tip.hash;
+    if (!spv_client_) {
+        // Not opened yet: report the last known tip, offline
+        status.is_syncing = false;
+        status.peer_count = 0;
+        status.sync_progress = 0.0;
+        return Result<NetworkStatus>::Ok(status);
+    }
     status.is_syncing = spv_client_->IsSyncing();
-    status.sync_progress = spv_client_->GetSyncProgress();
     status.peer_count = spv_client_->GetPeerCount();
 
+    // Progress from the same tip, not the client's own counter
+    uint64_t target_height = std::max(spv_client_->GetNetworkBestHeight(), tip.height);
+    status.sync_progress = target_height > 0
+        ? static_cast<double>(tip.height) / static_cast<double>(target_height)
+        : 0.0;
+
     return Result<NetworkStatus>::Ok(status);
 }
 
@@ -304,13 +463,7 @@ uint64_t MobileRPC::CalculateTransactionFee(const Transaction& tx) {
 }
 
 uint32_t MobileRPC::GetConfirmations(uint64_t block_height) {
-    uint64_t best_height = spv_client_->GetBestHeight();
-
-    if (block_height == 0 || block_height > best_height) {
-        return 0;  // Unconfirmed or invalid
-    }
-
-    return static_cast<uint32_t>(best_height - block_height + 1);
+    return ConfirmationsAt(RequestTip(spv_client_).height, block_height);
 }
 
 }  // namespace mobile
@@ -0,0 +1,31 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_rpc_context.h>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+const RPCContext g_empty_context;
+
+thread_local const RPCContext* t_current_context = nullptr;
+
+}  // namespace
+
+RPCContextScope::RPCContextScope(const RPCContext& context)
+    : context_(context), previous_(t_current_context) {
+    t_current_context = &context_;
+}
+
+RPCContextScope::~RPCContextScope() {
+    t_current_context = previous_;
+}
+
+const RPCContext& RPCContextScope::Current() {
+    return t_current_context ? *t_current_context : g_empty_context;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,271 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_rpc_metrics.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <limits>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+constexpr uint64_t SUB_BUCKET_COUNT = uint64_t{1} << LogLinearHistogram::SUB_BUCKET_BITS;
+
+/// Quantiles exported for each summary
+constexpr double EXPORTED_QUANTILES[] = {0.5, 0.9, 0.99, 0.999};
+
+int HighestBit(uint64_t value) {
+    return 63 - __builtin_clzll(value);
+}
+
+void AppendLine(std::string* out, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+void AppendLine(std::string* out, const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int n = std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (n > 0) {
+        out->append(line, std::min(static_cast<size_t>(n), sizeof(line) - 1));
+        out->push_back('\n');
+    }
+}
+
+/// Emit one summary: quantiles, sum, count and a max gauge
+/// @param scale Multiplier from recorded units to exported units
+/// @param selected Methods to include (nullptr = all)
+void AppendSummary(std::string* out, const char* name, const char* help, const RPCMetricsSnapshot& metrics,
+                   HistogramSnapshot RPCMethodMetrics::*member, double scale,
+                   bool (*selected)(RPCMethod) = nullptr) {
+    AppendLine(out, "# HELP %s %s", name, help);
+    AppendLine(out, "# TYPE %s summary", name);
+    for (const auto& method : metrics.methods) {
+        if (selected && !selected(method.method)) {
+            continue;
+        }
+        const HistogramSnapshot& histogram = method.*member;
+        const char* label = RPCMethodName(method.method);
+        for (double quantile : EXPORTED_QUANTILES) {
+            // Quantiles of an empty summary are NaN, as client libraries report them
+            if (histogram.count == 0) {
+                AppendLine(out, "%s{method=\"%s\",quantile=\"%g\"} NaN", name, label, quantile);
+                continue;
+            }
+            AppendLine(out, "%s{method=\"%s\",quantile=\"%g\"} %.9g", name, label, quantile,
+                       histogram.ValueAtPercentile(quantile * 100.0) * scale);
+        }
+        AppendLine(out, "%s_sum{method=\"%s\"} %.9g", name, label, histogram.sum * scale);
+        AppendLine(out, "%s_count{method=\"%s\"} %" PRIu64, name, label, histogram.count);
+    }
+
+    AppendLine(out, "# HELP %s_max Largest value recorded for %s", name, name);
+    AppendLine(out, "# TYPE %s_max gauge", name);
+    for (const auto& method : metrics.methods) {
+        if (selected && !selected(method.method)) {
+            continue;
+        }
+        AppendLine(out, "%s_max{method=\"%s\"} %.9g", name, RPCMethodName(method.method),
+                   (method.*member).max * scale);
+    }
+}
+
+}  // namespace
+
+const char* RPCMethodName(RPCMethod method) {
+    switch (method) {
+        case RPCMethod::SYNC: return "sync";
+        case RPCMethod::GET_BALANCE: return "get_balance";
+        case RPCMethod::GET_HISTORY: return "get_history";
+        case RPCMethod::SEND_TRANSACTION: return "send_transaction";
+        case RPCMethod::GET_UTXOS: return "get_utxos";
+        case RPCMethod::ESTIMATE_FEE: return "estimate_fee";
+        case RPCMethod::COUNT: break;
+    }
+    return "unknown";
+}
+
+bool RPCPayloadIsBytes(RPCMethod method) {
+    return method == RPCMethod::SEND_TRANSACTION || method == RPCMethod::ESTIMATE_FEE;
+}
+
+// ========================================
+// LogLinearHistogram
+// ========================================
+
+size_t LogLinearHistogram::BucketIndex(uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    int exponent = HighestBit(value);
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    // The bits below the top one pick the sub-bucket within the power of two
+    size_t group = static_cast<size_t>(exponent - SUB_BUCKET_BITS + 1);
+    size_t sub = static_cast<size_t>((value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+    return (group << SUB_BUCKET_BITS) | sub;
+}
+
+uint64_t LogLinearHistogram::BucketLowerBound(size_t index) {
+    size_t group = index >> SUB_BUCKET_BITS;
+    uint64_t sub = index & (SUB_BUCKET_COUNT - 1);
+    if (group == 0) {
+        return sub;
+    }
+    int shift = static_cast<int>(group) - 1;
+    return (SUB_BUCKET_COUNT | sub) << shift;
+}
+
+uint64_t LogLinearHistogram::BucketUpperBound(size_t index) {
+    if (index + 1 >= BUCKET_COUNT) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return BucketLowerBound(index + 1) - 1;
+}
+
+void LogLinearHistogram::Record(uint64_t value) {
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = max_.load(std::memory_order_relaxed);
+    while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSnapshot LogLinearHistogram::Snapshot() const {
+    HistogramSnapshot snapshot;
+    snapshot.buckets.resize(BUCKET_COUNT);
+    // Count comes from the buckets so percentiles always add up
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void LogLinearHistogram::Reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t HistogramSnapshot::ValueAtPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            if (i + 1 >= buckets.size()) {
+                return max;
+            }
+            // Middle of the bucket, but never past what was actually seen
+            uint64_t lower = LogLinearHistogram::BucketLowerBound(i);
+            uint64_t upper = LogLinearHistogram::BucketUpperBound(i);
+            return std::min(lower + (upper - lower) / 2, max);
+        }
+    }
+    return max;
+}
+
+// ========================================
+// RPCMetrics
+// ========================================
+
+RPCMetrics& RPCMetrics::Global() {
+    static RPCMetrics metrics;
+    return metrics;
+}
+
+void RPCMetrics::Record(RPCMethod method, uint64_t latency_ns, bool ok, uint64_t payload) {
+    if (method >= RPCMethod::COUNT) {
+        return;
+    }
+    MethodState& state = methods_[static_cast<size_t>(method)];
+    state.calls.fetch_add(1, std::memory_order_relaxed);
+    if (!ok) {
+        state.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    state.latency_ns.Record(latency_ns);
+    state.payload.Record(payload);
+}
+
+RPCMetricsSnapshot RPCMetrics::Snapshot() const {
+    RPCMetricsSnapshot snapshot;
+    snapshot.methods.reserve(RPC_METHOD_COUNT);
+    for (size_t i = 0; i < RPC_METHOD_COUNT; ++i) {
+        const MethodState& state = methods_[i];
+        RPCMethodMetrics method;
+        method.method = static_cast<RPCMethod>(i);
+        method.calls = state.calls.load(std::memory_order_relaxed);
+        method.errors = state.errors.load(std::memory_order_relaxed);
+        method.latency_ns = state.latency_ns.Snapshot();
+        method.payload = state.payload.Snapshot();
+        snapshot.methods.push_back(std::move(method));
+    }
+    return snapshot;
+}
+
+void RPCMetrics::Reset() {
+    for (auto& state : methods_) {
+        state.calls.store(0, std::memory_order_relaxed);
+        state.errors.store(0, std::memory_order_relaxed);
+        state.latency_ns.Reset();
+        state.payload.Reset();
+    }
+}
+
+// ========================================
+// Prometheus export
+// ========================================
+
+std::string FormatPrometheusMetrics(const RPCMetricsSnapshot& metrics) {
+    std::string out;
+    out.reserve(4096);
+
+    AppendLine(&out, "# HELP intcoin_rpc_calls_total Mobile RPC calls handled");
+    AppendLine(&out, "# TYPE intcoin_rpc_calls_total counter");
+    for (const auto& method : metrics.methods) {
+        AppendLine(&out, "intcoin_rpc_calls_total{method=\"%s\"} %" PRIu64, RPCMethodName(method.method),
+                   method.calls);
+    }
+
+    AppendLine(&out, "# HELP intcoin_rpc_errors_total Mobile RPC calls that failed or were rejected");
+    AppendLine(&out, "# TYPE intcoin_rpc_errors_total counter");
+    for (const auto& method : metrics.methods) {
+        AppendLine(&out, "intcoin_rpc_errors_total{method=\"%s\"} %" PRIu64, RPCMethodName(method.method),
+                   method.errors);
+    }
+
+    AppendSummary(&out, "intcoin_rpc_latency_seconds", "Mobile RPC call latency", metrics,
+                  &RPCMethodMetrics::latency_ns, 1e-9);
+    AppendSummary(&out, "intcoin_rpc_payload_items",
+                  "Mobile RPC payload items (sync: headers, get_balance: UTXOs, get_history: entries, "
+                  "get_utxos: UTXOs)",
+                  metrics, &RPCMethodMetrics::payload, 1.0,
+                  [](RPCMethod method) { return !RPCPayloadIsBytes(method); });
+    AppendSummary(&out, "intcoin_rpc_payload_bytes",
+                  "Mobile RPC payload size (send_transaction: raw transaction, estimate_fee: transaction size)",
+                  metrics, &RPCMethodMetrics::payload, 1.0, &RPCPayloadIsBytes);
+    return out;
+}
+
+}  // namespace mobile
+}  // namespace intcoin
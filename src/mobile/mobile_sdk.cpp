@@ -2,50 +2,173 @@
 // Distributed under the MIT software license
 
 #include <intcoin/mobile_sdk.h>
+#include <intcoin/mobile_address_validation.h>
+#include <intcoin/mobile_amount.h>
+#include <intcoin/mobile_coin_selection.h>
+#include <intcoin/mobile_payment_uri.h>
+#include <intcoin/mobile_payout_import.h>
+#include <intcoin/mobile_raw_tx.h>
+#include <intcoin/mobile_signing.h>
+#include <intcoin/mobile_trace.h>
+#include <intcoin/mobile_tx_builder.h>
+#include <intcoin/mobile_wallet_snapshot.h>
 #include <intcoin/crypto.h>
 #include <intcoin/util.h>
-#include <intcoin/bech32.h>
 
 #include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
 #include <cstring>
 #include <fstream>
-#include <iomanip>
-#include <sstream>
+#include <future>
+#include <set>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace intcoin {
 namespace mobile {
 
+namespace {
+
+constexpr char SNAPSHOT_TIP_MAGIC[8] = {'I', 'N', 'T', 'W', 'T', 'I', 'P', '1'};
+
+/// Ties the wallet snapshot to the tip it was taken at and to the wallet
+/// file it was taken from, so it can be trusted before any SPV client is up
+#pragma pack(push, 1)
+struct SnapshotTipRecord {
+    char magic[8];
+    uint64_t tip_height;
+    uint8_t tip_hash[32];
+    uint64_t wallet_size;      // Wallet file size when recorded
+    int64_t wallet_mtime_ns;   // Wallet file modification time when recorded
+};
+#pragma pack(pop)
+
+/// Bit array size of a bloom filter with the optimal bit count for its parameters
+size_t BloomFilterBytes(uint32_t elements, double fp_rate) {
+    if (elements == 0 || fp_rate <= 0.0 || fp_rate >= 1.0) {
+        return 0;
+    }
+    double bits = -static_cast<double>(elements) * std::log(fp_rate) / (std::log(2.0) * std::log(2.0));
+    return static_cast<size_t>(std::ceil(bits / 8.0));
+}
+
+/// Size and modification time of a file (false if it cannot be read)
+bool StatFile(const std::string& path, uint64_t* size, int64_t* mtime_ns) {
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) {
+        return false;
+    }
+#ifdef __APPLE__
+    const struct timespec& mtime = st.st_mtimespec;
+#else
+    const struct timespec& mtime = st.st_mtim;
+#endif
+    *size = static_cast<uint64_t>(st.st_size);
+    *mtime_ns = static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+    return true;
+}
+
+/// Replace a small file durably: written beside it, synced and renamed
+/// over it, so a crash leaves the old contents or the new, never a torn file
+bool ReplaceFile(const std::string& path, const void* data, size_t size) {
+    std::string tmp_path = path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool ok = ::write(fd, data, size) == static_cast<ssize_t>(size) && ::fsync(fd) == 0;
+    ok = ::close(fd) == 0 && ok;
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
 MobileSDK::MobileSDK(const SDKConfig& config)
-    : config_(config), wallet_open_(false) {
+    : config_(config), caller_thread_(std::this_thread::get_id()), wallet_open_(false),
+      confirmation_tracker_(config.confirmation_depths, memory_.Account(MemorySubsystem::PENDING_QUEUES)) {
+
+    auto start = std::chrono::steady_clock::now();
 
     LogF(LogLevel::INFO, "Mobile SDK: Initializing for INTcoin %s",
          config_.network.c_str());
 
-    // Create database backend
-    db_ = std::make_shared<BlockchainDB>(config_.wallet_path + "/spv_data");
+    // Database, SPV client and RPC handler are created on first use so that
+    // constructing the SDK stays off the app launch critical path
+    RecordStartupPhase("construct", start);
 
-    // Create SPV client if enabled
-    if (config_.enable_spv) {
-        spv_client_ = std::make_shared<SPVClient>(db_);
-        LogF(LogLevel::INFO, "Mobile SDK: SPV mode enabled");
+    // The buffer is process-wide; a second SDK must not wipe the first one's trace
+    if (config_.trace_events > 0) {
+        TraceBuffer::Global().StartIfStopped(config_.trace_events);
     }
 
-    // Create mobile RPC handler
-    rpc_ = std::make_shared<MobileRPC>(spv_client_, wallet_);
+    if (config_.background_warmup) {
+        WarmUp();
+    }
 
     LogF(LogLevel::INFO, "Mobile SDK: Initialized successfully");
 }
 
 MobileSDK::~MobileSDK() {
+    // Warm-up takes init_mutex_ itself, so join outside the lock
+    std::thread warmup;
+    {
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        warmup = std::move(warmup_thread_);
+    }
+    if (warmup.joinable()) {
+        warmup.join();
+    }
+
+    StopSyncMonitor();
     CloseWallet();
 }
 
+// ========================================
+// Initialization
+// ========================================
+
+void MobileSDK::WarmUp() {
+    if (!config_.enable_spv) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (warmup_thread_.joinable() || spv_client_) {
+        return;
+    }
+
+    LogF(LogLevel::DEBUG, "Mobile SDK: Starting background warm-up");
+
+    // Only the SPV side is warmed up: it owns the expensive database open and
+    // does not touch wallet state, which belongs to the caller thread
+    warmup_thread_ = std::thread([this]() {
+        GetSPVClient();
+    });
+}
+
+std::vector<StartupPhase> MobileSDK::GetStartupReport() const {
+    std::lock_guard<std::mutex> lock(startup_mutex_);
+    return startup_phases_;
+}
+
 // ========================================
 // Wallet Management
 // ========================================
 
 Result<std::string> MobileSDK::CreateWallet(const std::string& mnemonic,
                                             const std::string& password) {
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
     if (wallet_open_) {
         return Result<std::string>::Error("Wallet already open");
     }
@@ -76,10 +199,17 @@ Result<std::string> MobileSDK::CreateWallet(const std::string& mnemonic,
         return Result<std::string>::Error("Failed to create wallet: " + init_result.error);
     }
 
+    // A snapshot left by a previous wallet would pass the tip hash check
+    std::remove(GetSnapshotPath().c_str());
+    std::remove(GetSnapshotTipPath().c_str());
+
     wallet_open_ = true;
 
-    // Update bloom filter with wallet addresses
-    if (config_.enable_spv && spv_client_) {
+    ResetRPC();
+
+    // Update bloom filter if the SPV client is already running; otherwise it
+    // is built when sync starts
+    if (PeekSPVClient()) {
         UpdateBloomFilter();
     }
 
@@ -89,6 +219,7 @@ Result<std::string> MobileSDK::CreateWallet(const std::string& mnemonic,
 }
 
 Result<void> MobileSDK::OpenWallet(const std::string& password) {
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
     if (wallet_open_) {
         return Result<void>::Error("Wallet already open");
     }
@@ -101,17 +232,40 @@ Result<void> MobileSDK::OpenWallet(const std::string& password) {
     wallet_config.network = config_.network;
     wallet_ = std::make_shared<wallet::Wallet>(wallet_config);
 
-    // Load and decrypt wallet with password
-    auto load_result = wallet_->Load(password);
-    if (load_result.IsError()) {
-        wallet_.reset();
-        return Result<void>::Error("Failed to open wallet: " + load_result.error);
+    // Derived state (addresses, UTXOs, history) comes from the snapshot until
+    // the wallet moves past its tip. A snapshot taken from the wallet file as
+    // it is on disk is used at once; it is checked against the SPV client's
+    // tip once one is up.
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        snapshot_.reset();
+        snapshot_checked_ = false;
+        last_snapshot_height_ = 0;
+    }
+
+    if (LoadSnapshotOffline()) {
+        // Decrypting and loading the wallet is only needed for calls the
+        // snapshot cannot answer, so it runs off the caller thread
+        auto wallet = wallet_;
+        std::lock_guard<std::mutex> lock(wallet_load_mutex_);
+        wallet_load_ = std::async(std::launch::async, [wallet, password]() {
+            return wallet->Load(password);
+        }).share();
+    } else {
+        auto load_result = wallet_->Load(password);
+        if (load_result.IsError()) {
+            wallet_.reset();
+            return Result<void>::Error("Failed to open wallet: " + load_result.error);
+        }
     }
 
     wallet_open_ = true;
 
-    // Update bloom filter
-    if (config_.enable_spv && spv_client_) {
+    ResetRPC();
+
+    // Update bloom filter if the SPV client is already running; otherwise it
+    // is built when sync starts
+    if (PeekSPVClient()) {
         UpdateBloomFilter();
     }
 
@@ -127,18 +281,86 @@ void MobileSDK::CloseWallet() {
 
     LogF(LogLevel::INFO, "Mobile SDK: Closing wallet");
 
+    // Sync stops below, and with it the polls that read the wallet. The
+    // monitor may be waiting for the wallet lock, so it is joined first.
+    StopSyncMonitor();
+
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    if (!wallet_open_) {
+        return;
+    }
+
+    auto spv_client = PeekSPVClient();
+
+    // Persist derived state so the next open does not rebuild it. A wallet
+    // that never finished loading has no state worth keeping.
+    ChainTip tip = CaptureChainTip(&chain_tip_, spv_client);
+    bool snapshot_current = false;
+    if (AwaitWalletLoad().IsOk()) {
+        std::shared_ptr<WalletSnapshot> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(snapshot_mutex_);
+            snapshot = snapshot_;
+        }
+        if (snapshot && snapshot->GetTipHash() == tip.hash) {
+            snapshot_current = true;
+        } else if (tip.hash != uint256{}) {
+            auto snapshot_result = WriteWalletSnapshot();
+            if (snapshot_result.IsError()) {
+                LogF(LogLevel::WARNING, "Mobile SDK: Wallet snapshot not written: %s",
+                     snapshot_result.error.c_str());
+            }
+            snapshot_current = snapshot_result.IsOk();
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        snapshot_.reset();
+        snapshot_checked_ = false;
+        last_snapshot_height_ = 0;
+    }
+
     // Stop sync
-    if (spv_client_) {
-        spv_client_->StopSync();
+    if (spv_client) {
+        spv_client->StopSync();
     }
 
     // Clear bloom filter
-    if (spv_client_) {
-        spv_client_->ClearBloomFilter();
+    if (spv_client) {
+        spv_client->ClearBloomFilter();
+    }
+    if (bloom_filter_bytes_ > 0) {
+        memory_.Account(MemorySubsystem::BLOOM_FILTER)->Freed(bloom_filter_bytes_);
+        bloom_filter_bytes_ = 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        address_index_.reset();
+        address_index_tip_ = ChainTip{};
+        unconfirmed_sends_.clear();
     }
 
+    {
+        std::lock_guard<std::mutex> lock(wallet_load_mutex_);
+        wallet_load_ = std::shared_future<Result<void>>();
+    }
     wallet_.reset();
     wallet_open_ = false;
+    ResetRPC();
+
+    // The wallet may save itself as it is released, so the tip record is
+    // written against the file as it is left on disk. Without a current
+    // snapshot the next open loads the wallet in full.
+    if (snapshot_current) {
+        auto tip_result = SaveSnapshotTip(tip);
+        if (tip_result.IsError()) {
+            LogF(LogLevel::WARNING, "Mobile SDK: %s", tip_result.error.c_str());
+            std::remove(GetSnapshotTipPath().c_str());
+        }
+    } else {
+        std::remove(GetSnapshotTipPath().c_str());
+    }
 
     LogF(LogLevel::INFO, "Mobile SDK: Wallet closed");
 }
@@ -151,6 +373,11 @@ Result<std::vector<uint8_t>> MobileSDK::BackupWallet() {
     if (!wallet_open_) {
         return Result<std::vector<uint8_t>>::Error("Wallet not open");
     }
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<std::vector<uint8_t>>::Error(load_result.error);
+    }
 
     LogF(LogLevel::INFO, "Mobile SDK: Creating wallet backup");
 
@@ -181,6 +408,7 @@ Result<std::vector<uint8_t>> MobileSDK::BackupWallet() {
 
 Result<void> MobileSDK::RestoreWallet(const std::vector<uint8_t>& backup_data,
                                       const std::string& password) {
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
     if (wallet_open_) {
         return Result<void>::Error("Wallet already open");
     }
@@ -211,11 +439,16 @@ Result<void> MobileSDK::RestoreWallet(const std::vector<uint8_t>& backup_data,
 
     // Remove temporary file
     std::remove(backup_path.c_str());
+    std::remove(GetSnapshotPath().c_str());
+    std::remove(GetSnapshotTipPath().c_str());
 
     wallet_open_ = true;
 
-    // Update bloom filter
-    if (config_.enable_spv && spv_client_) {
+    ResetRPC();
+
+    // Update bloom filter if the SPV client is already running; otherwise it
+    // is built when sync starts
+    if (PeekSPVClient()) {
         UpdateBloomFilter();
     }
 
@@ -232,6 +465,11 @@ Result<std::string> MobileSDK::GetNewAddress() {
     if (!wallet_open_) {
         return Result<std::string>::Error("Wallet not open");
     }
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<std::string>::Error(load_result.error);
+    }
 
     // Generate new address from wallet using BIP32/44 derivation path: m/44'/2210'/0'/0/n
     auto addr_result = wallet_->GetNewAddress();
@@ -242,9 +480,19 @@ Result<std::string> MobileSDK::GetNewAddress() {
     std::string address = *addr_result.value;
     LogF(LogLevel::DEBUG, "Mobile SDK: Generated new address: %s", address.c_str());
 
+    // Snapshot address list is now stale
+    ResetSnapshot();
+
+    {
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        if (address_index_) {
+            address_index_->Watch(address);
+        }
+    }
+
     // Add to bloom filter for SPV tracking
-    if (config_.enable_spv && spv_client_) {
-        spv_client_->AddWatchAddress(address);
+    if (auto spv_client = PeekSPVClient()) {
+        spv_client->AddWatchAddress(address);
     }
 
     return Result<std::string>::Ok(address);
@@ -254,6 +502,11 @@ Result<std::string> MobileSDK::GetCurrentAddress() {
     if (!wallet_open_) {
         return Result<std::string>::Error("Wallet not open");
     }
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<std::string>::Error(load_result.error);
+    }
 
     // Get current receiving address from wallet
     auto addrs_result = wallet_->GetAddresses();
@@ -279,9 +532,21 @@ std::vector<std::string> MobileSDK::GetAllAddresses() {
         return {};
     }
 
-    // Get all addresses from wallet
     std::vector<std::string> addresses;
 
+    if (auto snapshot = GetSnapshot()) {
+        addresses.reserve(snapshot->GetAddressCount());
+        for (size_t i = 0; i < snapshot->GetAddressCount(); ++i) {
+            addresses.emplace_back(snapshot->GetAddress(i));
+        }
+        return addresses;
+    }
+
+    // Get all addresses from wallet
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    if (AwaitWalletLoad().IsError()) {
+        return addresses;
+    }
     auto addrs_result = wallet_->GetAddresses();
     if (addrs_result.IsOk()) {
         for (const auto& addr_info : *addrs_result.value) {
@@ -293,23 +558,9 @@ std::vector<std::string> MobileSDK::GetAllAddresses() {
 }
 
 bool MobileSDK::ValidateAddress(const std::string& address) {
-    // INTcoin uses Bech32 format: int1... (mainnet) or tint1... (testnet)
-    bool is_mainnet = address.size() >= 4 && address.substr(0, 4) == "int1";
-    bool is_testnet = address.size() >= 5 && address.substr(0, 5) == "tint1";
-
-    if (!is_mainnet && !is_testnet) {
-        return false;
-    }
-
-    // Use wallet's Bech32 validation
-    auto decode_result = Bech32::Decode(address);
-    if (decode_result.IsError()) {
-        return false;
-    }
-
-    // Verify expected data length for Dilithium5 pubkey hash (32 bytes)
-    const auto& decoded = *decode_result.value;
-    return decoded.data.size() >= 32;
+    // INTcoin uses Bech32 format: int1... (mainnet) or tint1... (testnet),
+    // with at least 32 data characters before the checksum
+    return ValidateAddressFast(address) == AddressError::OK;
 }
 
 // ========================================
@@ -321,43 +572,114 @@ Result<BalanceResponse> MobileSDK::GetBalance() {
         return Result<BalanceResponse>::Error("Wallet not open");
     }
 
-    // Get current receiving address for query
-    auto addr_result = GetCurrentAddress();
-    if (addr_result.IsError()) {
-        return Result<BalanceResponse>::Error(addr_result.error);
+    if (auto snapshot = GetSnapshot()) {
+        BalanceResponse response;
+        response.confirmed_balance = snapshot->GetConfirmedBalance();
+        response.unconfirmed_balance = snapshot->GetUnconfirmedBalance();
+        response.total_balance = response.confirmed_balance + response.unconfirmed_balance;
+        response.utxo_count = static_cast<uint32_t>(snapshot->GetUTXOCount());
+        return Result<BalanceResponse>::Ok(response);
     }
 
+    // Totals are kept by the address index; an empty address asks for the whole wallet
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<BalanceResponse>::Error(load_result.error);
+    }
+    GetAddressIndex();
+
     BalanceRequest request;
-    request.address = addr_result.GetValue();
     request.min_confirmations = 1;
 
-    return rpc_->GetBalance(request);
+    RPCContextScope rpc_context(GetRPCContext());
+    return GetRPC()->GetBalance(request);
 }
 
 Result<UTXOResponse> MobileSDK::GetUTXOs(uint32_t min_confirmations) {
     if (!wallet_open_) {
         return Result<UTXOResponse>::Error("Wallet not open");
     }
-
-    auto addr_result = GetCurrentAddress();
-    if (addr_result.IsError()) {
-        return Result<UTXOResponse>::Error(addr_result.error);
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<UTXOResponse>::Error(load_result.error);
     }
 
+    GetAddressIndex();
+
+    // Empty address lists coins of every wallet address
     UTXORequest request;
-    request.address = addr_result.GetValue();
     request.min_confirmations = min_confirmations;
 
-    return rpc_->GetUTXOs(request);
+    RPCContextScope rpc_context(GetRPCContext());
+    return GetRPC()->GetUTXOs(request);
 }
 
 // ========================================
 // Transaction Management
 // ========================================
 
+Result<std::shared_ptr<const SortedUTXOIndex>> MobileSDK::TakeUTXOSnapshot(uint32_t min_confirmations) {
+    using SnapshotResult = Result<std::shared_ptr<const SortedUTXOIndex>>;
+    TraceSpan span("send", "utxo_snapshot");
+
+    std::vector<TxInputCoin> coins;
+
+    if (auto snapshot = GetSnapshot()) {
+        uint64_t tip_height = snapshot->GetTipHeight();
+        coins.reserve(snapshot->GetUTXOCount());
+        for (size_t i = 0; i < snapshot->GetUTXOCount(); ++i) {
+            const auto& record = snapshot->GetUTXOs()[i];
+            if (ConfirmationsAt(tip_height, record.block_height) >= min_confirmations) {
+                TxInputCoin coin;
+                std::memcpy(coin.tx_hash.data(), record.tx_hash, sizeof(record.tx_hash));
+                coin.output_index = record.output_index;
+                coin.amount = record.amount;
+                coins.push_back(coin);
+            }
+        }
+        return SnapshotResult::Ok(std::make_shared<const SortedUTXOIndex>(std::move(coins)));
+    }
+
+    // A coin in a block has one confirmation whatever the tip, so only deeper
+    // requirements read the chain. Before the SPV client is open the last
+    // published tip is used; with none, deeper confirmations are unknown and
+    // no coin qualifies.
+    uint64_t tip_height = 0;
+    if (min_confirmations > 1) {
+        tip_height = CaptureChainTip(&chain_tip_, PeekSPVClient()).height;
+    }
+
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return SnapshotResult::Error(load_result.error);
+    }
+    auto utxos_result = wallet_->GetUTXOs();
+    if (utxos_result.IsError()) {
+        return SnapshotResult::Error(utxos_result.error);
+    }
+
+    const auto& wallet_utxos = *utxos_result.value;
+    coins.reserve(wallet_utxos.size());
+    for (const auto& utxo : wallet_utxos) {
+        uint32_t confirmations = min_confirmations > 1
+            ? ConfirmationsAt(tip_height, utxo.block_height)
+            : (utxo.block_height > 0 ? 1 : 0);
+        if (confirmations >= min_confirmations) {
+            coins.push_back({utxo.outpoint.tx_hash, utxo.outpoint.index, utxo.value});
+        }
+    }
+
+    return SnapshotResult::Ok(std::make_shared<const SortedUTXOIndex>(std::move(coins)));
+}
+
 Result<Transaction> MobileSDK::CreateTransaction(const std::string& to_address,
                                                  uint64_t amount_ints,
                                                  uint64_t fee_rate) {
+    TraceSpan span("send", "create_transaction");
+
     if (!wallet_open_) {
         return Result<Transaction>::Error("Wallet not open");
     }
@@ -367,417 +689,1752 @@ Result<Transaction> MobileSDK::CreateTransaction(const std::string& to_address,
         return Result<Transaction>::Error("Invalid recipient address");
     }
 
-    // Get UTXOs
-    auto utxo_result = GetUTXOs(1);
-    if (utxo_result.IsError()) {
-        return Result<Transaction>::Error("Failed to get UTXOs: " + utxo_result.error);
+    // One read of the wallet's coins serves the balance check, fee
+    // estimation and coin selection below
+    auto snapshot_result = TakeUTXOSnapshot(1);
+    if (snapshot_result.IsError()) {
+        return Result<Transaction>::Error("Failed to get UTXOs: " + snapshot_result.error);
     }
-
-    UTXOResponse utxos = utxo_result.GetValue();
+    const SortedUTXOIndex& utxo_index = *snapshot_result.GetValue();
 
     // Check sufficient balance
-    if (utxos.total_amount < amount_ints) {
+    if (utxo_index.GetTotal() < amount_ints) {
         return Result<Transaction>::Error("Insufficient balance");
     }
 
-    // Estimate fee if not provided
-    if (fee_rate == 0) {
-        auto fee_result = EstimateFee(to_address, amount_ints, 6);
-        if (fee_result.IsError()) {
-            return Result<Transaction>::Error("Failed to estimate fee: " + fee_result.error);
-        }
-        fee_rate = fee_result.GetValue().fee_rate;
+    // Estimate fee if not provided, sized for the inputs this payment needs
+    auto fee_rate_result = ResolveFeeRate(utxo_index, amount_ints, 1, fee_rate);
+    if (fee_rate_result.IsError()) {
+        return Result<Transaction>::Error(fee_rate_result.error);
     }
 
-    // Create transaction using wallet's coin selection and signing
-    wallet::SendRequest send_request;
-    send_request.recipient_address = to_address;
-    send_request.amount = amount_ints;
-    send_request.fee_rate = fee_rate;
-    send_request.subtract_fee_from_amount = false;
+    auto selection_result = SelectInputs(utxo_index, amount_ints, 1, fee_rate_result.GetValue());
+    if (selection_result.IsError()) {
+        return Result<Transaction>::Error(selection_result.error);
+    }
+    const CoinSelectionResult& selection = selection_result.GetValue();
 
-    auto tx_result = wallet_->CreateTransaction(send_request);
-    if (tx_result.IsError()) {
-        return Result<Transaction>::Error("Transaction creation failed: " + tx_result.error);
+    auto unsigned_result = BuildFromSelection(selection, {{to_address, amount_ints}});
+    if (unsigned_result.IsError()) {
+        return unsigned_result;
+    }
+
+    auto signed_result = SignTransactionBatch({unsigned_result.GetValue()});
+    if (signed_result.IsError()) {
+        return Result<Transaction>::Error(signed_result.error);
     }
+    Transaction tx = signed_result.GetValue().front();
 
-    Transaction tx = *tx_result.value;
-    LogF(LogLevel::INFO, "Mobile SDK: Created transaction to %s for %llu INTS (fee: %llu)",
-         to_address.c_str(), amount_ints, tx.GetFee());
+    LogF(LogLevel::INFO, "Mobile SDK: Created transaction to %s for %llu INTS (fee: %llu, %zu inputs, %s)",
+         to_address.c_str(), amount_ints, selection.fee, selection.coins.size(),
+         CoinSelectionStrategyName(selection.strategy));
 
     return Result<Transaction>::Ok(tx);
 }
 
-Result<uint256> MobileSDK::SendTransaction(const Transaction& tx) {
+Result<std::vector<Transaction>> MobileSDK::CreateBatchTransaction(
+    const std::vector<TxRecipient>& recipients,
+    uint64_t fee_rate,
+    size_t max_tx_size) {
+    using BatchResult = Result<std::vector<Transaction>>;
+
     if (!wallet_open_) {
-        return Result<uint256>::Error("Wallet not open");
+        return BatchResult::Error("Wallet not open");
     }
-
-    // Serialize transaction
-    std::vector<uint8_t> serialized_tx = tx.Serialize();
-
-    SendTransactionRequest request;
-    request.raw_transaction = serialized_tx;
-
-    auto result = rpc_->SendTransaction(request);
-    if (result.IsError()) {
-        return Result<uint256>::Error(result.error);
+    if (recipients.empty()) {
+        return BatchResult::Error("No recipients");
     }
 
-    SendTransactionResponse response = result.GetValue();
-
-    if (!response.accepted) {
-        return Result<uint256>::Error("Transaction rejected: " + response.error);
+    // Smallest transaction: one input, one payment, change
+    if (max_tx_size > 0 && max_tx_size < EstimateTransactionSize(1, 2)) {
+        return BatchResult::Error("Transaction size cap too small");
     }
 
-    LogF(LogLevel::INFO, "Mobile SDK: Broadcast transaction %s",
-         BytesToHex(std::vector<uint8_t>(response.tx_hash.begin(),
-                                        response.tx_hash.end())).substr(0, 16).c_str());
-
-    // Trigger transaction event
-    if (tx_callback_) {
-        TxEvent event;
-        event.type = TxEventType::PENDING;
-        event.tx_hash = response.tx_hash;
-        event.amount_ints = 0;  // Calculate from tx
-        event.confirmations = 0;
-        event.timestamp = std::time(nullptr);
-        ProcessTransactionEvent(event);
+    uint64_t total_amount = 0;
+    for (const auto& recipient : recipients) {
+        if (!ValidateAddress(recipient.address)) {
+            return BatchResult::Error("Invalid recipient address: " + recipient.address);
+        }
+        if (recipient.amount_ints == 0) {
+            return BatchResult::Error("Invalid amount for " + recipient.address);
+        }
+        if (total_amount + recipient.amount_ints < total_amount) {
+            return BatchResult::Error("Batch total overflows");
+        }
+        total_amount += recipient.amount_ints;
     }
 
-    return Result<uint256>::Ok(response.tx_hash);
-}
-
-Result<HistoryResponse> MobileSDK::GetTransactionHistory(uint32_t limit, uint32_t offset) {
-    if (!wallet_open_) {
-        return Result<HistoryResponse>::Error("Wallet not open");
+    auto snapshot_result = TakeUTXOSnapshot(1);
+    if (snapshot_result.IsError()) {
+        return BatchResult::Error("Failed to get UTXOs: " + snapshot_result.error);
     }
+    std::shared_ptr<const SortedUTXOIndex> pool = snapshot_result.GetValue();
 
-    auto addr_result = GetCurrentAddress();
-    if (addr_result.IsError()) {
-        return Result<HistoryResponse>::Error(addr_result.error);
+    if (pool->GetTotal() < total_amount) {
+        return BatchResult::Error("Insufficient balance");
     }
 
-    HistoryRequest request;
-    request.address = addr_result.GetValue();
-    request.page_size = limit;
-    request.page = offset / limit;
-
-    return rpc_->GetHistory(request);
+    return CreateBatchFromPool(&pool, recipients, total_amount, fee_rate, max_tx_size);
 }
 
-Result<HistoryEntry> MobileSDK::GetTransaction(const uint256& tx_hash) {
-    if (!wallet_open_) {
-        return Result<HistoryEntry>::Error("Wallet not open");
-    }
+Result<std::vector<Transaction>> MobileSDK::CreateBatchFromPool(
+    std::shared_ptr<const SortedUTXOIndex>* coins,
+    const std::vector<TxRecipient>& recipients,
+    uint64_t total_amount,
+    uint64_t fee_rate,
+    size_t max_tx_size,
+    std::vector<size_t>* group_sizes) {
+    using BatchResult = Result<std::vector<Transaction>>;
+
+    std::shared_ptr<const SortedUTXOIndex> pool = *coins;
+
+    auto fee_rate_result = ResolveFeeRate(*pool, total_amount, recipients.size(), fee_rate);
+    if (fee_rate_result.IsError()) {
+        return BatchResult::Error(fee_rate_result.error);
+    }
+    fee_rate = fee_rate_result.GetValue();
+
+    // Most payments a capped transaction can carry alongside one input and change
+    size_t max_outputs = recipients.size();
+    if (max_tx_size > 0) {
+        max_outputs = (max_tx_size - EstimateTransactionSize(1, 1)) / TX_OUTPUT_SIZE;
+    }
+
+    std::vector<Transaction> transactions;
+    std::vector<uint64_t> changes;
+    uint64_t total_fee = 0;
+    size_t total_inputs = 0;
+    size_t next = 0;
+    if (group_sizes) {
+        group_sizes->clear();
+    }
+
+    while (next < recipients.size()) {
+        size_t count = std::min(max_outputs, recipients.size() - next);
+
+        // Shrink the group until its funded size fits under the cap
+        CoinSelectionResult selection;
+        std::vector<TxRecipient> group;
+        for (;;) {
+            group.assign(recipients.begin() + next, recipients.begin() + next + count);
+            uint64_t group_amount = 0;
+            for (const auto& recipient : group) {
+                group_amount += recipient.amount_ints;
+            }
 
-    // Look up transaction directly in wallet
-    auto tx_result = wallet_->GetTransaction(tx_hash);
-    if (tx_result.IsOk()) {
-        const auto& tx_info = *tx_result.value;
-        HistoryEntry entry;
-        entry.tx_hash = tx_info.tx_hash;
-        entry.amount_ints = tx_info.amount;
-        entry.confirmations = 0;
-        if (tx_info.block_height > 0 && spv_client_) {
-            uint64_t current_height = spv_client_->GetBestHeight();
-            if (current_height >= tx_info.block_height) {
-                entry.confirmations = static_cast<uint32_t>(current_height - tx_info.block_height + 1);
+            auto selection_result = SelectInputs(*pool, group_amount, group.size(), fee_rate);
+            if (selection_result.IsError()) {
+                return BatchResult::Error(selection_result.error);
+            }
+            selection = selection_result.GetValue();
+
+            if (max_tx_size == 0 || selection.tx_size <= max_tx_size) {
+                break;
             }
+            if (count == 1) {
+                return BatchResult::Error("Payment to " + group.front().address +
+                                          " does not fit in the transaction size cap");
+            }
+            count /= 2;
         }
-        entry.timestamp = tx_info.timestamp;
-        entry.is_incoming = tx_info.is_incoming;
-        return Result<HistoryEntry>::Ok(entry);
+
+        auto tx_result = BuildFromSelection(selection, group);
+        if (tx_result.IsError()) {
+            return BatchResult::Error(tx_result.error);
+        }
+        transactions.push_back(tx_result.GetValue());
+        changes.push_back(selection.change);
+        if (group_sizes) {
+            group_sizes->push_back(count);
+        }
+        total_fee += selection.fee;
+        total_inputs += selection.coins.size();
+        next += count;
+
+        // Later transactions, in this batch or the caller's next one, draw from what is left
+        std::set<std::pair<uint256, uint32_t>> spent;
+        for (const auto& coin : selection.coins) {
+            spent.emplace(coin.tx_hash, coin.output_index);
+        }
+        std::vector<TxInputCoin> remaining;
+        remaining.reserve(pool->Size() - selection.coins.size());
+        for (const auto& coin : pool->GetCoins()) {
+            if (!spent.count({coin.tx_hash, coin.output_index})) {
+                remaining.push_back(coin);
+            }
+        }
+        pool = std::make_shared<const SortedUTXOIndex>(std::move(remaining));
     }
 
-    // Fallback: search through history
-    auto history_result = GetTransactionHistory(1000, 0);
-    if (history_result.IsError()) {
-        return Result<HistoryEntry>::Error(history_result.error);
+    // Signing dominates, and the transactions are independent once built
+    auto signed_result = SignTransactionBatch(transactions);
+    if (signed_result.IsError()) {
+        return BatchResult::Error(signed_result.error);
     }
+    transactions = std::move(*signed_result.value);
 
-    for (const auto& entry : history_result.GetValue().entries) {
-        if (entry.tx_hash == tx_hash) {
-            return Result<HistoryEntry>::Ok(entry);
+    // Change is the last output and its hash is known once signed; the
+    // caller's next batch may spend it before it confirms
+    std::vector<TxInputCoin> next_pool = pool->GetCoins();
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        if (changes[i] > 0) {
+            next_pool.push_back({transactions[i].GetHash(),
+                                 static_cast<uint32_t>(transactions[i].outputs.size() - 1), changes[i]});
         }
     }
+    *coins = std::make_shared<const SortedUTXOIndex>(std::move(next_pool));
 
-    return Result<HistoryEntry>::Error("Transaction not found");
-}
-
-Result<FeeEstimateResponse> MobileSDK::EstimateFee(const std::string& to_address,
-                                                    uint64_t amount_ints,
-                                                    uint32_t target_blocks) {
-    // Estimate transaction size (typical P2PKH: ~250 bytes)
-    uint32_t estimated_size = 250;
-
-    FeeEstimateRequest request;
-    request.tx_size = estimated_size;
-    request.target_blocks = target_blocks;
+    LogF(LogLevel::INFO, "Mobile SDK: Created %zu batch transaction(s) for %zu recipients, "
+         "%llu INTS (fee: %llu, %zu inputs)",
+         transactions.size(), recipients.size(), total_amount, total_fee, total_inputs);
 
-    return rpc_->EstimateFee(request);
+    return BatchResult::Ok(transactions);
 }
 
-// ========================================
-// Sync & Network
-// ========================================
+Result<PayoutImportSummary> MobileSDK::ImportPayouts(const std::string& path,
+                                                     const PayoutImportOptions& options,
+                                                     PayoutProgressCallback progress) {
+    using ImportResult = Result<PayoutImportSummary>;
 
-Result<void> MobileSDK::StartSync() {
-    if (!config_.enable_spv || !spv_client_) {
-        return Result<void>::Error("SPV not enabled");
+    if (!wallet_open_ && !options.dry_run) {
+        return ImportResult::Error("Wallet not open");
     }
-
-    LogF(LogLevel::INFO, "Mobile SDK: Starting blockchain sync");
-
-    auto result = spv_client_->StartSync();
-    if (result.IsError()) {
-        return result;
+    if (options.chunk_rows == 0 || options.batch_recipients == 0) {
+        return ImportResult::Error("Invalid import options");
+    }
+    if (options.max_tx_size > 0 && options.max_tx_size < EstimateTransactionSize(1, 2)) {
+        return ImportResult::Error("Transaction size cap too small");
     }
 
-    // Progress updates are handled by the SPV client's sync loop
-    // The sync_callback_ will be invoked by UpdateSyncProgress() when sync events occur
+    AddressNetwork network = AddressNetwork::ANY;
+    if (config_.network == "mainnet") {
+        network = AddressNetwork::MAINNET;
+    } else if (config_.network == "testnet") {
+        network = AddressNetwork::TESTNET;
+    }
 
-    return Result<void>::Ok();
-}
+    // Validation is CPU-bound and touches no wallet state, so it is spread
+    // over the workers
+    WorkerPool* workers = GetSigningPool();
 
-void MobileSDK::StopSync() {
-    if (!config_.enable_spv || !spv_client_) {
-        return;
+    // Rows an earlier run of this file paid
+    std::string resume_path = options.resume_path.empty() ? path + ".paid" : options.resume_path;
+    auto resume_result = LoadPayoutResumePoint(resume_path);
+    if (resume_result.IsError()) {
+        return ImportResult::Error(resume_result.error);
     }
+    const PayoutResumePoint paid = resume_result.GetValue();
 
-    LogF(LogLevel::INFO, "Mobile SDK: Stopping blockchain sync");
-    spv_client_->StopSync();
-}
+    PayoutImportSummary summary;
+    PayoutImportProgress& totals = summary.totals;
 
-bool MobileSDK::IsSyncing() const {
-    if (!config_.enable_spv || !spv_client_) {
-        return false;
-    }
+    // Stream the file once, handing each accepted row to on_accepted
+    auto scan = [&](bool verifying, const std::function<Result<void>(const PayoutRow&)>& on_accepted) {
+        auto reader_result = PayoutFileReader::Open(path, options.format);
+        if (reader_result.IsError()) {
+            return Result<void>::Error(reader_result.error);
+        }
+        std::unique_ptr<PayoutFileReader> reader = std::move(*reader_result.value);
+
+        PayoutImportProgress previous = totals;
+        totals = PayoutImportProgress();
+        totals.total_bytes = reader->GetFileSize();
+        totals.estimated_fees = previous.estimated_fees;
+        totals.transactions_sent = previous.transactions_sent;
+        totals.verifying = verifying;
+        summary.rejections.clear();
+
+        PayoutDeduplicator seen;
+        uint64_t fingerprint = PAYOUT_FINGERPRINT_INIT;
+        std::vector<PayoutRow> rows;
+        rows.reserve(options.chunk_rows);
+
+        for (;;) {
+            auto read_result = reader->Read(options.chunk_rows, &rows);
+            if (read_result.IsError()) {
+                return Result<void>::Error(read_result.error);
+            }
+            if (read_result.GetValue() == 0) {
+                break;
+            }
 
-    return spv_client_->IsSyncing();
-}
+            ValidatePayoutRows(&rows, network, workers);
 
-SyncProgress MobileSDK::GetSyncProgress() const {
-    SyncProgress progress;
+            for (auto& row : rows) {
+                ++totals.rows_read;
+                if (row.error.empty() && !seen.Insert(row.address)) {
+                    row.error = "Duplicate address";
+                    ++totals.duplicates;
+                }
 
-    if (!config_.enable_spv || !spv_client_) {
-        progress.current_height = 0;
-        progress.target_height = 0;
-        progress.progress = 0.0;
-        progress.is_syncing = false;
-        return progress;
-    }
+                if (!row.error.empty()) {
+                    ++totals.rows_rejected;
+                    if (summary.rejections.size() < MAX_REPORTED_REJECTIONS) {
+                        summary.rejections.push_back({row.line, row.address, row.error});
+                    }
+                    if (options.stop_on_invalid) {
+                        return Result<void>::Error("Line " + std::to_string(row.line) + ": " + row.error);
+                    }
+                    continue;
+                }
 
-    progress.current_height = spv_client_->GetBestHeight();
-    progress.target_height = spv_client_->GetNetworkBestHeight();
-    progress.progress = spv_client_->GetSyncProgress();
-    progress.is_syncing = spv_client_->IsSyncing();
+                if (totals.amount_accepted + row.amount_ints < totals.amount_accepted) {
+                    return Result<void>::Error("Payout total overflows");
+                }
+                totals.amount_accepted += row.amount_ints;
+                ++totals.rows_accepted;
+
+                // Paid rows are checked against the record and skipped
+                if (totals.rows_paid_before < paid.rows_paid) {
+                    fingerprint = PayoutFingerprint(fingerprint, row);
+                    ++totals.rows_paid_before;
+                    totals.amount_paid_before += row.amount_ints;
+                    if (totals.rows_paid_before == paid.rows_paid && fingerprint != paid.fingerprint) {
+                        return Result<void>::Error("Payout file does not match the payments recorded in " +
+                                                   resume_path);
+                    }
+                    continue;
+                }
 
-    return progress;
-}
+                if (on_accepted) {
+                    auto accept_result = on_accepted(row);
+                    if (accept_result.IsError()) {
+                        return accept_result;
+                    }
+                }
+            }
 
-Result<MobileRPC::NetworkStatus> MobileSDK::GetNetworkStatus() {
-    return rpc_->GetNetworkStatus();
-}
+            totals.bytes_read = reader->GetBytesRead();
+            if (progress) {
+                progress(totals);
+            }
+        }
 
-// ========================================
-// QR Code Support
-// ========================================
+        if (totals.rows_paid_before < paid.rows_paid) {
+            return Result<void>::Error("Payout file does not match the payments recorded in " + resume_path);
+        }
+        return Result<void>::Ok();
+    };
 
-std::string MobileSDK::GeneratePaymentURI(const std::string& address,
-                                          uint64_t amount_ints,
-                                          const std::string& label,
-                                          const std::string& message) {
-    std::ostringstream uri;
-    uri << "intcoin:" << address;
+    if (options.verify_first || options.dry_run) {
+        auto verify_result = scan(true, nullptr);
+        if (verify_result.IsError()) {
+            return ImportResult::Error(verify_result.error);
+        }
 
-    bool has_params = false;
+        uint64_t amount_due = totals.amount_accepted - totals.amount_paid_before;
+        uint64_t rows_due = totals.rows_accepted - totals.rows_paid_before;
+        if (wallet_open_ && rows_due > 0) {
+            auto snapshot_result = TakeUTXOSnapshot(1);
+            if (snapshot_result.IsError()) {
+                return ImportResult::Error("Failed to get UTXOs: " + snapshot_result.error);
+            }
+            const SortedUTXOIndex& coins = *snapshot_result.GetValue();
 
-    if (amount_ints > 0) {
-        uri << "?amount=" << FormatINTS(amount_ints);
-        has_params = true;
-    }
+            auto fee_result = EstimatePayoutFees(coins, amount_due, rows_due, options);
+            if (fee_result.IsError()) {
+                return ImportResult::Error(fee_result.error);
+            }
+            totals.estimated_fees = fee_result.GetValue();
 
-    if (!label.empty()) {
-        uri << (has_params ? "&" : "?") << "label=" << label;
-        has_params = true;
+            // Change goes back into the pool, so the fees are all that is used up besides the payouts
+            if (coins.GetTotal() < amount_due || coins.GetTotal() - amount_due < totals.estimated_fees) {
+                return ImportResult::Error("Insufficient balance: payouts total " + FormatINTS(amount_due) +
+                                           " plus about " + FormatINTS(totals.estimated_fees) + " in fees");
+            }
+        }
+
+        if (options.dry_run) {
+            LogF(LogLevel::INFO, "Mobile SDK: Checked payout file %s (%llu accepted, %llu rejected, "
+                 "%llu already paid, %llu INTS due)",
+                 path.c_str(), totals.rows_accepted, totals.rows_rejected, totals.rows_paid_before, amount_due);
+            return ImportResult::Ok(summary);
+        }
     }
 
-    if (!message.empty()) {
-        uri << (has_params ? "&" : "?") << "message=" << message;
+    // Coins are taken once; each batch spends from what earlier ones left,
+    // including their change
+    auto snapshot_result = TakeUTXOSnapshot(1);
+    if (snapshot_result.IsError()) {
+        return ImportResult::Error("Failed to get UTXOs: " + snapshot_result.error);
     }
+    std::shared_ptr<const SortedUTXOIndex> coins = snapshot_result.GetValue();
 
-    return uri.str();
-}
+    std::vector<PayoutRow> batch;
+    batch.reserve(options.batch_recipients);
+    uint64_t batch_amount = 0;
+    PayoutResumePoint recorded = paid;
 
-Result<MobileSDK::PaymentDetails> MobileSDK::ParsePaymentURI(const std::string& uri) {
-    PaymentDetails details;
-    details.amount_ints = 0;
+    auto send_batch = [&]() {
+        if (coins->GetTotal() < batch_amount) {
+            return Result<void>::Error("Insufficient balance");
+        }
 
-    // Parse intcoin: URI
-    if (uri.substr(0, 8) != "intcoin:") {
-        return Result<PaymentDetails>::Error("Invalid URI scheme");
-    }
+        std::vector<TxRecipient> recipients;
+        recipients.reserve(batch.size());
+        for (const auto& row : batch) {
+            recipients.push_back({row.address, row.amount_ints});
+        }
 
-    // Extract address and parameters
-    size_t param_start = uri.find('?');
-    details.address = uri.substr(8, param_start - 8);
+        std::vector<size_t> group_sizes;
+        auto batch_result = CreateBatchFromPool(&coins, recipients, batch_amount,
+                                                options.fee_rate, options.max_tx_size, &group_sizes);
+        if (batch_result.IsError()) {
+            return Result<void>::Error(batch_result.error);
+        }
 
-    if (!ValidateAddress(details.address)) {
+        size_t next = 0;
+        for (size_t i = 0; i < batch_result.GetValue().size(); ++i) {
+            // Recorded first: a crash before the send leaves these rows
+            // unpaid rather than letting a rerun pay them twice
+            PayoutResumePoint before = recorded;
+            for (size_t j = next; j < next + group_sizes[i]; ++j) {
+                recorded.fingerprint = PayoutFingerprint(recorded.fingerprint, batch[j]);
+                recorded.amount_paid += batch[j].amount_ints;
+            }
+            recorded.rows_paid += group_sizes[i];
+            ++recorded.transactions_sent;
+            next += group_sizes[i];
+
+            auto save_result = SavePayoutResumePoint(resume_path, recorded);
+            if (save_result.IsError()) {
+                return save_result;
+            }
+
+            auto send_result = SendTransaction(batch_result.GetValue()[i]);
+            if (send_result.IsError()) {
+                recorded = before;
+                auto restore_result = SavePayoutResumePoint(resume_path, recorded);
+                if (restore_result.IsError()) {
+                    LogF(LogLevel::WARNING, "Mobile SDK: %s; rows up to line %llu are recorded as paid but were not",
+                         restore_result.error.c_str(), batch[next - 1].line);
+                }
+                return Result<void>::Error(send_result.error);
+            }
+            summary.tx_hashes.push_back(send_result.GetValue());
+            ++totals.transactions_sent;
+        }
+        batch.clear();
+        batch_amount = 0;
+        return Result<void>::Ok();
+    };
+
+    auto send_result = scan(false, [&](const PayoutRow& row) {
+        batch.push_back(row);
+        batch_amount += row.amount_ints;
+        return batch.size() < options.batch_recipients ? Result<void>::Ok() : send_batch();
+    });
+    if (send_result.IsOk() && !batch.empty()) {
+        send_result = send_batch();
+        if (send_result.IsOk() && progress) {
+            progress(totals);
+        }
+    }
+
+    if (send_result.IsError()) {
+        // What went out stays out and is recorded; running the import
+        // again pays the rest
+        LogF(LogLevel::WARNING, "Mobile SDK: Payout import from %s stopped after %llu transaction(s): %s",
+             path.c_str(), totals.transactions_sent, send_result.error.c_str());
+        if (totals.transactions_sent > 0) {
+            return ImportResult::Error(send_result.error + " (" + std::to_string(totals.transactions_sent) +
+                                       " transaction(s) already sent; run again to resume)");
+        }
+        return ImportResult::Error(send_result.error);
+    }
+
+    LogF(LogLevel::INFO, "Mobile SDK: Imported payout file %s (%llu accepted, %llu rejected, "
+         "%llu paid before, %llu INTS in %llu transaction(s))",
+         path.c_str(), totals.rows_accepted, totals.rows_rejected, totals.rows_paid_before,
+         totals.amount_accepted - totals.amount_paid_before, totals.transactions_sent);
+
+    return ImportResult::Ok(summary);
+}
+
+Result<uint64_t> MobileSDK::EstimatePayoutFees(const SortedUTXOIndex& coins,
+                                               uint64_t amount_ints,
+                                               uint64_t recipients,
+                                               const PayoutImportOptions& options) {
+    if (recipients == 0) {
+        return Result<uint64_t>::Ok(0);
+    }
+
+    size_t batch_size = static_cast<size_t>(std::min<uint64_t>(recipients, options.batch_recipients));
+    auto fee_rate_result = ResolveFeeRate(coins, amount_ints, batch_size, options.fee_rate);
+    if (fee_rate_result.IsError()) {
+        return Result<uint64_t>::Error(fee_rate_result.error);
+    }
+
+    // Payments per transaction, as CreateBatchFromPool splits a batch
+    uint64_t per_tx = options.batch_recipients;
+    if (options.max_tx_size > 0) {
+        per_tx = std::min<uint64_t>(per_tx, (options.max_tx_size - EstimateTransactionSize(1, 1)) / TX_OUTPUT_SIZE);
+    }
+    per_tx = std::max<uint64_t>(per_tx, 1);
+
+    uint64_t full_batches = recipients / options.batch_recipients;
+    uint64_t last_batch = recipients % options.batch_recipients;
+    uint64_t tx_count = full_batches * ((options.batch_recipients + per_tx - 1) / per_tx) +
+                        (last_batch + per_tx - 1) / per_tx;
+
+    // Enough coins for the payouts, plus the change of each earlier transaction
+    uint64_t inputs = coins.EstimateInputCount(amount_ints) + tx_count - 1;
+    uint64_t size = tx_count * EstimateTransactionSize(0, 1) + recipients * TX_OUTPUT_SIZE +
+                    inputs * TX_INPUT_SIZE;
+
+    return Result<uint64_t>::Ok(std::max(size * fee_rate_result.GetValue() / 1000, tx_count * MIN_TX_FEE));
+}
+
+Result<uint256> MobileSDK::SendTransaction(const Transaction& tx) {
+    TraceSpan span("send", "send_transaction");
+
+    if (!wallet_open_) {
+        return Result<uint256>::Error("Wallet not open");
+    }
+
+    // Serialize once; the bytes are checked and hashed once, then queued
+    // and relayed as-is. The transaction itself is already in hand.
+    std::vector<uint8_t> raw_tx;
+    {
+        TraceSpan serialize_span("send", "serialize");
+        raw_tx = tx.Serialize();
+    }
+    auto view_result = RawTransactionView::Parse(raw_tx.data(), raw_tx.size());
+    if (view_result.IsError()) {
+        return Result<uint256>::Error("Transaction rejected: " + view_result.error);
+    }
+    return QueueTransaction(std::move(raw_tx), view_result.GetValue(), tx);
+}
+
+Result<uint256> MobileSDK::SendRawTransaction(std::vector<uint8_t> raw_tx) {
+    if (!wallet_open_) {
+        return Result<uint256>::Error("Wallet not open");
+    }
+
+    auto view_result = RawTransactionView::Parse(raw_tx.data(), raw_tx.size());
+    if (view_result.IsError()) {
+        return Result<uint256>::Error("Transaction rejected: " + view_result.error);
+    }
+
+    // The wallet bookkeeping below works on the core's transaction type
+    auto tx_result = Transaction::Deserialize(raw_tx);
+    if (tx_result.IsError()) {
+        return Result<uint256>::Error("Transaction rejected: " + tx_result.error);
+    }
+
+    // Debug builds confirm the view's reading of the layout matches the
+    // core's; release builds trust Parse
+    assert(CheckViewMatchesCore(view_result.GetValue(), tx_result.GetValue()).IsOk());
+
+    return QueueTransaction(std::move(raw_tx), view_result.GetValue(), tx_result.GetValue());
+}
+
+Result<uint256> MobileSDK::QueueTransaction(std::vector<uint8_t> raw_tx, const RawTransactionView& view,
+                                            const Transaction& tx) {
+    TraceSpan span("send", "send_raw_transaction");
+    span.SetArg("bytes", static_cast<int64_t>(raw_tx.size()));
+
+    // Sends are queued here rather than relayed by MobileRPC::SendTransaction,
+    // so they are counted here too
+    const uint64_t raw_size = raw_tx.size();
+    RPCCallScope call(RPCMethod::SEND_TRANSACTION, raw_size);
+
+    // Without SPV there are no peers, and a queued send would never leave
+    BroadcastQueue* broadcast_queue = GetBroadcastQueue();
+    if (!broadcast_queue) {
+        return Result<uint256>::Error("SPV not enabled, transactions cannot be broadcast");
+    }
+
+    // Journaled before returning; the queue retries until a peer acknowledges
+    Result<uint256> queue_result;
+    {
+        TraceSpan queue_span("send", "journal_enqueue");
+        queue_result = broadcast_queue->Enqueue(std::move(raw_tx), view);
+    }
+    if (queue_result.IsError()) {
+        return Result<uint256>::Error("Transaction rejected: " + queue_result.error);
+    }
+
+    const uint256& tx_hash = queue_result.GetValue();
+
+    // Spent outputs and history are no longer those in the snapshot
+    ResetSnapshot();
+
+    // Change back to the wallet is not part of what the payment sends
+    uint64_t amount_sent = AmountSentBy(tx);
+    confirmation_tracker_.Track(tx_hash, amount_sent);
+
+    {
+        // Spent coins leave the address index now rather than at confirmation,
+        // and stay gone across rebuilds until the wallet sees the send mined
+        TraceSpan index_span("send", "index_spend");
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        unconfirmed_sends_.push_back(tx);
+        if (address_index_) {
+            address_index_->AddTransaction(tx);
+        }
+    }
+
+    LogF(LogLevel::INFO, "Mobile SDK: Queued transaction %s for broadcast",
+         BytesToHex(std::vector<uint8_t>(tx_hash.begin(), tx_hash.end())).substr(0, 16).c_str());
+
+    // Trigger transaction event (the callback is read under its lock there)
+    TxEvent event;
+    event.type = TxEventType::PENDING;
+    event.tx_hash = tx_hash;
+    event.amount_ints = amount_sent;
+    event.confirmations = 0;
+    event.timestamp = std::time(nullptr);
+    ProcessTransactionEvent(event);
+
+    call.Succeeded(raw_size);
+    return Result<uint256>::Ok(tx_hash);
+}
+
+Result<HistoryResponse> MobileSDK::GetTransactionHistory(uint32_t limit, uint32_t offset) {
+    if (!wallet_open_) {
+        return Result<HistoryResponse>::Error("Wallet not open");
+    }
+    if (limit == 0) {
+        return Result<HistoryResponse>::Error("Page size must be at least 1");
+    }
+
+    if (auto snapshot = GetSnapshot()) {
+        HistoryResponse response;
+        response.page = offset / limit;
+        response.total_count = static_cast<uint32_t>(snapshot->GetHistoryCount());
+        response.total_pages = (response.total_count + limit - 1) / limit;
+
+        uint64_t tip_height = snapshot->GetTipHeight();
+        size_t start_idx = static_cast<size_t>(response.page) * limit;
+        size_t end_idx = std::min(start_idx + limit, snapshot->GetHistoryCount());
+
+        for (size_t i = start_idx; i < end_idx; ++i) {
+            const auto& record = snapshot->GetHistory()[i];
+            HistoryEntry entry;
+            std::memcpy(entry.tx_hash.data(), record.tx_hash, sizeof(record.tx_hash));
+            entry.amount_ints = record.amount;
+            entry.confirmations = ConfirmationsAt(tip_height, record.block_height);
+            entry.timestamp = record.timestamp;
+            entry.is_incoming = record.is_incoming != 0;
+            response.entries.push_back(entry);
+        }
+
+        return Result<HistoryResponse>::Ok(response);
+    }
+
+    // Empty address pages through the wallet's own history
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<HistoryResponse>::Error(load_result.error);
+    }
+    HistoryRequest request;
+    request.page_size = limit;
+    request.page = offset / limit;
+
+    RPCContextScope rpc_context(GetRPCContext());
+    return GetRPC()->GetHistory(request);
+}
+
+Result<HistoryEntry> MobileSDK::GetTransaction(const uint256& tx_hash) {
+    if (!wallet_open_) {
+        return Result<HistoryEntry>::Error("Wallet not open");
+    }
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<HistoryEntry>::Error(load_result.error);
+    }
+
+    // Look up transaction directly in wallet
+    auto tx_result = wallet_->GetTransaction(tx_hash);
+    if (tx_result.IsOk()) {
+        const auto& tx_info = *tx_result.value;
+        HistoryEntry entry;
+        entry.tx_hash = tx_info.tx_hash;
+        entry.amount_ints = tx_info.amount;
+        // Reads do not open the SPV client; with no tip yet, confirmations are 0
+        entry.confirmations = ConfirmationsAt(CaptureChainTip(&chain_tip_, PeekSPVClient()).height,
+                                              tx_info.block_height);
+        entry.timestamp = tx_info.timestamp;
+        entry.is_incoming = tx_info.is_incoming;
+        return Result<HistoryEntry>::Ok(entry);
+    }
+
+    // Fallback: search through history
+    auto history_result = GetTransactionHistory(1000, 0);
+    if (history_result.IsError()) {
+        return Result<HistoryEntry>::Error(history_result.error);
+    }
+
+    for (const auto& entry : history_result.GetValue().entries) {
+        if (entry.tx_hash == tx_hash) {
+            return Result<HistoryEntry>::Ok(entry);
+        }
+    }
+
+    return Result<HistoryEntry>::Error("Transaction not found");
+}
+
+Result<FeeEstimateResponse> MobileSDK::EstimateFee(const std::string& to_address,
+                                                    uint64_t amount_ints,
+                                                    uint32_t target_blocks) {
+    // Estimate transaction size for one Dilithium5 input, payment and change
+    uint32_t estimated_size = static_cast<uint32_t>(EstimateTransactionSize(1, 2));
+
+    FeeEstimateRequest request;
+    request.tx_size = estimated_size;
+    request.target_blocks = target_blocks;
+
+    RPCContextScope rpc_context(GetRPCContext());
+    return GetRPC()->EstimateFee(request);
+}
+
+// ========================================
+// Sync & Network
+// ========================================
+
+Result<void> MobileSDK::StartSync() {
+    TraceSpan span("sync", "start_sync");
+
+    std::shared_ptr<SPVClient> spv_client;
+    {
+        TraceSpan open_span("sync", "open_spv_client");
+        spv_client = GetSPVClient();
+    }
+    if (!spv_client) {
+        return Result<void>::Error("SPV not enabled");
+    }
+
+    LogF(LogLevel::INFO, "Mobile SDK: Starting blockchain sync");
+
+    // The filter is deferred until the SPV client is actually needed
+    if (wallet_open_) {
+        UpdateBloomFilter();
+    }
+
+    Result<void> result;
+    {
+        TraceSpan spv_span("sync", "spv_start_sync");
+        result = spv_client->StartSync();
+    }
+    if (result.IsError()) {
+        return result;
+    }
+
+    // Resume anything left unacknowledged by a previous session, and since
+    // connectivity is back, do not wait out the backoff of queued sends
+    {
+        TraceSpan retry_span("sync", "retry_queued_sends");
+        GetBroadcastQueue()->RetryNow();
+    }
+
+    // The SPV client reports no events, so progress, snapshots and the
+    // sync callback are driven by polling it
+    StartSyncMonitor();
+
+    return Result<void>::Ok();
+}
+
+void MobileSDK::StopSync() {
+    StopSyncMonitor();
+
+    auto spv_client = PeekSPVClient();
+    if (!spv_client) {
+        return;
+    }
+
+    LogF(LogLevel::INFO, "Mobile SDK: Stopping blockchain sync");
+    spv_client->StopSync();
+}
+
+bool MobileSDK::IsSyncing() const {
+    auto spv_client = PeekSPVClient();
+    if (!spv_client) {
+        return false;
+    }
+
+    return spv_client->IsSyncing();
+}
+
+ChainTip MobileSDK::GetChainTip() const {
+    return CaptureChainTip(&chain_tip_, PeekSPVClient());
+}
+
+RPCContext MobileSDK::GetRPCContext() const {
+    RPCContext context;
+    context.chain_tip = &chain_tip_;
+
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    context.address_index = address_index_;
+    return context;
+}
+
+void MobileSDK::PublishChainTip() {
+    auto spv_client = PeekSPVClient();
+    if (!spv_client) {
+        return;
+    }
+
+    // Readers keep the published tip until the client has moved on
+    ChainTip tip = ReadChainTip(spv_client);
+    auto published = chain_tip_.Get();
+    if (!published || published->height != tip.height || published->hash != tip.hash) {
+        // Where polling sees new blocks; block_connected only comes from the hooks
+        TraceSpan span("sync", "tip_advanced");
+        span.SetArg("height", static_cast<int64_t>(tip.height));
+        chain_tip_.Publish(tip);
+    }
+}
+
+SyncProgress MobileSDK::GetSyncProgress() const {
+    SyncProgress progress;
+
+    auto spv_client = PeekSPVClient();
+    if (!spv_client) {
+        progress.current_height = 0;
+        progress.target_height = 0;
+        progress.progress = 0.0;
+        progress.is_syncing = false;
+        return progress;
+    }
+
+    // Both heights and the ratio come from one tip, so they always agree
+    ChainTip tip = CaptureChainTip(&chain_tip_, spv_client);
+    progress.current_height = tip.height;
+    progress.target_height = std::max(spv_client->GetNetworkBestHeight(), tip.height);
+    progress.progress = progress.target_height > 0
+        ? static_cast<double>(tip.height) / static_cast<double>(progress.target_height)
+        : 0.0;
+    progress.is_syncing = spv_client->IsSyncing();
+
+    return progress;
+}
+
+void MobileSDK::NotifyBlockConnected(uint64_t height,
+                                     const uint256& block_hash,
+                                     const std::vector<Transaction>& matched_txs,
+                                     const uint256& chain_work) {
+    TraceSpan span("sync", "block_connected");
+    span.SetArg("matched_txs", static_cast<int64_t>(matched_txs.size()));
+
+    if (PeekSPVClient()) {
+        chain_tip_.Publish(ChainTip{height, block_hash, chain_work});
+    }
+
+    if (auto address_index = GetAddressIndex()) {
+        TraceSpan index_span("sync", "index_block");
+        address_index->BlockConnected(height, matched_txs);
+    }
+
+    std::vector<uint256> matched_txids;
+    matched_txids.reserve(matched_txs.size());
+    for (const auto& tx : matched_txs) {
+        matched_txids.push_back(tx.GetHash());
+    }
+
+    ReportConfirmationUpdates(confirmation_tracker_.BlockConnected(height, matched_txids));
+}
+
+void MobileSDK::NotifyBlockDisconnected(uint64_t height, const uint256& block_hash) {
+    TraceSpan span("sync", "block_disconnected");
+
+    auto spv_client = PeekSPVClient();
+    if (spv_client) {
+        // The new tip is the removed block's parent
+        ChainTip tip;
+        tip.height = height > 0 ? height - 1 : 0;
+        auto header_result = spv_client->GetHeader(block_hash);
+        if (header_result.IsOk()) {
+            tip.hash = header_result.GetValue().prev_block_hash;
+        } else {
+            tip.hash = spv_client->GetBestHash();
+        }
+        chain_tip_.Publish(tip);
+    }
+
+    if (auto address_index = GetAddressIndex()) {
+        address_index->BlockDisconnected(height);
+    }
+
+    auto updates = confirmation_tracker_.BlockDisconnected(height);
+    if (!updates.empty()) {
+        LogF(LogLevel::WARNING, "Mobile SDK: Block %llu disconnected, %zu sent transaction(s) unconfirmed",
+             height, updates.size());
+    }
+
+    ReportConfirmationUpdates(updates);
+}
+
+void MobileSDK::ReportConfirmationUpdates(const std::vector<ConfirmationUpdate>& updates) {
+    for (const auto& update : updates) {
+        TxEvent event;
+        event.type = update.confirmations > 0 ? TxEventType::CONFIRMED : TxEventType::PENDING;
+        event.tx_hash = update.tx_hash;
+        event.amount_ints = update.amount_ints;
+        event.confirmations = update.confirmations;
+        event.timestamp = std::time(nullptr);
+        ProcessTransactionEvent(event);
+    }
+}
+
+std::vector<ConfirmationUpdate> MobileSDK::RefreshConfirmations() {
+    if (confirmation_tracker_.GetTrackedCount() == 0) {
+        return {};
+    }
+    auto spv_client = PeekSPVClient();
+    if (!spv_client) {
+        return {};
+    }
+
+    // Where a transaction was mined only changes with the tip
+    ChainTip tip = CaptureChainTip(&chain_tip_, spv_client);
+    if (tip.height == confirmations_tip_.height && tip.hash == confirmations_tip_.hash) {
+        return {};
+    }
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    if (AwaitWalletLoad().IsError()) {
+        return {};
+    }
+    confirmations_tip_ = tip;
+
+    TraceSpan span("sync", "refresh_confirmations");
+    span.SetArg("tracked", static_cast<int64_t>(confirmation_tracker_.GetTrackedCount()));
+
+    auto wallet = wallet_;
+    auto block_height = [&wallet](const uint256& tx_hash) -> uint64_t {
+        auto tx_result = wallet->GetTransaction(tx_hash);
+        return tx_result.IsOk() ? tx_result.GetValue().block_height : 0;
+    };
+    return confirmation_tracker_.Refresh(tip.height, block_height);
+}
+
+uint64_t MobileSDK::AmountSentBy(const Transaction& tx) {
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    if (AwaitWalletLoad().IsError()) {
+        return 0;
+    }
+
+    std::set<std::vector<uint8_t>> own_scripts;
+    auto addrs_result = wallet_->GetAddresses();
+    if (addrs_result.IsOk()) {
+        for (const auto& info : *addrs_result.value) {
+            auto script_result = ScriptForAddress(info.address);
+            if (script_result.IsOk()) {
+                own_scripts.insert(script_result.GetValue().bytes);
+            }
+        }
+    }
+
+    uint64_t amount = 0;
+    for (const auto& output : tx.outputs) {
+        if (!own_scripts.count(output.script_pubkey.bytes)) {
+            amount += output.value;
+        }
+    }
+    return amount;
+}
+
+BroadcastMetrics MobileSDK::GetBroadcastMetrics() {
+    // Reading metrics does not start the queue (or the SPV client under it)
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!broadcast_queue_) {
+        return BroadcastMetrics();
+    }
+    return broadcast_queue_->GetMetrics();
+}
+
+RPCMetricsSnapshot MobileSDK::GetMetrics() const {
+    return RPCMetrics::Global().Snapshot();
+}
+
+MemoryUsage MobileSDK::GetMemoryUsage() const {
+    MemoryUsage usage;
+    memory_.AddTo(&usage);
+
+    std::shared_ptr<AddressIndex> address_index;
+    {
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        address_index = address_index_;
+    }
+    if (address_index) {
+        address_index->AddMemoryUsage(&usage);
+    }
+    return usage;
+}
+
+Result<MobileRPC::NetworkStatus> MobileSDK::GetNetworkStatus() {
+    RPCContextScope rpc_context(GetRPCContext());
+    return GetRPC()->GetNetworkStatus();
+}
+
+// ========================================
+// QR Code Support
+// ========================================
+
+std::string MobileSDK::GeneratePaymentURI(const std::string& address,
+                                          uint64_t amount_ints,
+                                          const std::string& label,
+                                          const std::string& message) {
+    // Sized exactly, so the string is allocated once
+    std::string uri(PaymentURISize(address, amount_ints, label, message) + 1, '\0');
+    auto build_result = BuildPaymentURI(uri.data(), uri.size(), address, amount_ints, label, message);
+    if (build_result.IsError()) {
+        LogF(LogLevel::WARNING, "Mobile SDK: Payment URI not generated: %s", build_result.error.c_str());
+        return "";
+    }
+    uri.resize(build_result.GetValue());
+    return uri;
+}
+
+Result<MobileSDK::PaymentDetails> MobileSDK::ParsePaymentURI(const std::string& uri) {
+    // Decoded label and message never exceed the URI; QR payloads fit on the stack
+    char stack_scratch[512];
+    std::vector<char> heap_scratch;
+    char* scratch = stack_scratch;
+    if (uri.size() > sizeof(stack_scratch)) {
+        heap_scratch.resize(uri.size());
+        scratch = heap_scratch.data();
+    }
+
+    auto view_result = mobile::ParsePaymentURI(uri, scratch, std::max(uri.size(), sizeof(stack_scratch)));
+    if (view_result.IsError()) {
+        return Result<PaymentDetails>::Error(view_result.error);
+    }
+    const PaymentURIView& view = view_result.GetValue();
+
+    PaymentDetails details;
+    details.address = std::string(view.address);
+    details.amount_ints = view.amount_ints;
+    details.label = std::string(view.label);
+    details.message = std::string(view.message);
+
+    if (!ValidateAddress(details.address)) {
         return Result<PaymentDetails>::Error("Invalid address in URI");
     }
 
-    // Parse parameters
-    if (param_start != std::string::npos) {
-        std::string params = uri.substr(param_start + 1);
+    return Result<PaymentDetails>::Ok(details);
+}
+
+// ========================================
+// Callbacks
+// ========================================
+
+void MobileSDK::SetTransactionCallback(std::function<void(const TxEvent&)> callback) {
+    // Called from the sync monitor thread as well as the caller's
+    std::lock_guard<std::mutex> lock(sync_monitor_mutex_);
+    tx_callback_ = callback;
+}
+
+void MobileSDK::SetSyncProgressCallback(std::function<void(const SyncProgress&)> callback) {
+    // Called from the sync monitor thread
+    std::lock_guard<std::mutex> lock(sync_monitor_mutex_);
+    sync_callback_ = callback;
+}
+
+// ========================================
+// Utility
+// ========================================
+
+std::string MobileSDK::FormatINTS(uint64_t ints) {
+    // 1 INT = 1,000,000 INTS
+    AmountFormat format;
+    format.unit_suffix = true;
+
+    char buf[MAX_AMOUNT_CHARS];
+    auto [end, ec] = AmountToChars(buf, buf + sizeof(buf), ints, format);
+    return std::string(buf, end);
+}
+
+Result<uint64_t> MobileSDK::ParseINTAmount(const std::string& amount_str) {
+    // Parse "1.5" (INT) or "1500000" (INTS) to INTS
+    const char* first = amount_str.data();
+    const char* last = first + amount_str.size();
+    uint64_t ints = 0;
+
+    bool is_int = amount_str.find('.') != std::string::npos;
+    std::errc ec;
+    const char* end;
+    if (is_int) {
+        auto result = AmountFromChars(first, last, ints);
+        end = result.ptr;
+        ec = result.ec;
+    } else {
+        auto result = std::from_chars(first, last, ints);
+        end = result.ptr;
+        ec = result.ec;
+    }
+
+    if (ec == std::errc::result_out_of_range) {
+        return Result<uint64_t>::Error("Amount out of range");
+    }
+    if (ec != std::errc() || end != last) {
+        return Result<uint64_t>::Error("Invalid amount format");
+    }
+    return Result<uint64_t>::Ok(ints);
+}
+
+std::string MobileSDK::GetVersion() {
+    return "1.2.0-beta";
+}
+
+// ========================================
+// Private Methods
+// ========================================
+
+std::shared_ptr<SPVClient> MobileSDK::GetSPVClient() {
+    if (!config_.enable_spv) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (spv_client_) {
+        return spv_client_;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    db_ = std::make_shared<BlockchainDB>(config_.wallet_path + "/spv_data");
+    RecordStartupPhase("open_database", start);
+
+    start = std::chrono::steady_clock::now();
+    spv_client_ = std::make_shared<SPVClient>(db_);
+    RecordStartupPhase("create_spv_client", start);
+
+    // Rebuilt against the client on the next request
+    rpc_.reset();
+
+    LogF(LogLevel::INFO, "Mobile SDK: SPV mode enabled");
+
+    return spv_client_;
+}
+
+std::shared_ptr<SPVClient> MobileSDK::PeekSPVClient() const {
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    return spv_client_;
+}
+
+std::shared_ptr<MobileRPC> MobileSDK::GetRPC() {
+    // Reads go through the handler, so it must not open the SPV client;
+    // GetSPVClient drops a handler built without one
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!rpc_) {
+        auto start = std::chrono::steady_clock::now();
+        rpc_ = std::make_shared<MobileRPC>(spv_client_, wallet_);
+        RecordStartupPhase("create_rpc_handler", start);
+    }
+
+    return rpc_;
+}
+
+void MobileSDK::ResetRPC() {
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    rpc_.reset();
+}
+
+void MobileSDK::RecordStartupPhase(const char* name,
+                                   std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    StartupPhase phase;
+    phase.name = name;
+    phase.duration_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    phase.on_caller_thread = std::this_thread::get_id() == caller_thread_;
+
+    LogF(LogLevel::DEBUG, "Mobile SDK: Startup phase %s took %llu us%s",
+         name, phase.duration_us, phase.on_caller_thread ? "" : " (background)");
+
+    std::lock_guard<std::mutex> lock(startup_mutex_);
+    startup_phases_.push_back(phase);
+}
+
+void MobileSDK::UpdateBloomFilter() {
+    auto spv_client = PeekSPVClient();
+    if (!spv_client || !wallet_open_) {
+        return;
+    }
+
+    TraceSpan span("sync", "update_bloom_filter");
+
+    // Create bloom filter for wallet addresses
+    BloomFilter filter(config_.bloom_filter_addresses,
+                      config_.bloom_fp_rate,
+                      std::time(nullptr) & 0xFFFFFFFF);
+
+    // Add all wallet addresses to filter
+    auto addresses = GetAllAddresses();
+    for (const auto& address : addresses) {
+        // The pubkey hash as bytes, as it appears in output scripts
+        AddressProgram program;
+        if (DecodeAddressProgram(address, &program) == AddressError::OK) {
+            filter.Add(std::vector<uint8_t>(program.begin(), program.end()));
+        } else {
+            // Fallback: add raw address string
+            std::vector<uint8_t> addr_data(address.begin(), address.end());
+            filter.Add(addr_data);
+        }
+    }
+
+    span.SetArg("addresses", static_cast<int64_t>(addresses.size()));
+
+    TraceSpan load_span("sync", "load_bloom_filter");
+    spv_client->SetBloomFilter(filter);
+
+    // The core filter does not expose its size, so charge what it allocates for these parameters
+    MemoryAccount* bloom_memory = memory_.Account(MemorySubsystem::BLOOM_FILTER);
+    if (bloom_filter_bytes_ > 0) {
+        bloom_memory->Freed(bloom_filter_bytes_);
+    }
+    bloom_filter_bytes_ = BloomFilterBytes(config_.bloom_filter_addresses, config_.bloom_fp_rate);
+    bloom_memory->Allocated(bloom_filter_bytes_);
+
+    LogF(LogLevel::INFO, "Mobile SDK: Updated bloom filter with %zu addresses",
+         addresses.size());
+}
+
+void MobileSDK::ProcessTransactionEvent(const TxEvent& event) {
+    std::function<void(const TxEvent&)> callback;
+    {
+        std::lock_guard<std::mutex> lock(sync_monitor_mutex_);
+        callback = tx_callback_;
+    }
+    if (callback) {
+        callback(event);
+    }
+
+    LogF(LogLevel::INFO, "Mobile SDK: Transaction event - %s for %llu INTS",
+         event.type == TxEventType::RECEIVED ? "Received" :
+         event.type == TxEventType::SENT ? "Sent" :
+         event.type == TxEventType::CONFIRMED ? "Confirmed" : "Pending",
+         event.amount_ints);
+}
+
+Result<uint64_t> MobileSDK::ResolveFeeRate(const SortedUTXOIndex& utxos,
+                                           uint64_t amount_ints,
+                                           size_t num_outputs,
+                                           uint64_t fee_rate) {
+    if (fee_rate != 0) {
+        return Result<uint64_t>::Ok(fee_rate);
+    }
+
+    TraceSpan span("send", "estimate_fee_rate");
+
+    FeeEstimateRequest fee_request;
+    fee_request.tx_size = static_cast<uint32_t>(
+        EstimateTransactionSize(utxos.EstimateInputCount(amount_ints), num_outputs + 1));
+    fee_request.target_blocks = 6;
+
+    RPCContextScope rpc_context(GetRPCContext());
+    auto fee_result = GetRPC()->EstimateFee(fee_request);
+    if (fee_result.IsError()) {
+        return Result<uint64_t>::Error("Failed to estimate fee: " + fee_result.error);
+    }
+    return Result<uint64_t>::Ok(fee_result.GetValue().fee_rate);
+}
+
+Result<CoinSelectionResult> MobileSDK::SelectInputs(const SortedUTXOIndex& utxos,
+                                                    uint64_t amount_ints,
+                                                    size_t num_outputs,
+                                                    uint64_t fee_rate) {
+    TraceSpan span("send", "select_inputs");
+    span.SetArg("utxos", static_cast<int64_t>(utxos.Size()));
+
+    CoinSelectionParams params;
+    params.target = amount_ints;
+    params.fee_rate = fee_rate;
+    params.num_outputs = num_outputs;
+    params.strategy = config_.coin_selection;
+    params.time_budget = std::chrono::milliseconds(config_.coin_selection_budget_ms);
+
+    auto selection_result = SelectCoins(utxos, params);
+    if (selection_result.IsError()) {
+        return Result<CoinSelectionResult>::Error("Coin selection failed: " + selection_result.error);
+    }
+    return selection_result;
+}
+
+Result<Transaction> MobileSDK::BuildFromSelection(const CoinSelectionResult& selection,
+                                                  const std::vector<TxRecipient>& recipients) {
+    TraceSpan span("send", "build_unsigned");
+
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<Transaction>::Error(load_result.error);
+    }
+
+    std::string change_address;
+    if (selection.change > 0) {
+        auto change_result = wallet_->GetChangeAddress();
+        if (change_result.IsError()) {
+            return Result<Transaction>::Error("Failed to get change address: " + change_result.error);
+        }
+        change_address = change_result.GetValue();
+    }
+
+    auto unsigned_result = BuildUnsignedTransaction(selection.coins, recipients,
+                                                    change_address, selection.change);
+    if (unsigned_result.IsError()) {
+        return Result<Transaction>::Error("Transaction creation failed: " + unsigned_result.error);
+    }
 
-        // Parse key=value pairs separated by &
-        size_t pos = 0;
-        while (pos < params.size()) {
-            size_t amp_pos = params.find('&', pos);
-            std::string param = (amp_pos == std::string::npos)
-                               ? params.substr(pos)
-                               : params.substr(pos, amp_pos - pos);
+    return unsigned_result;
+}
 
-            size_t eq_pos = param.find('=');
-            if (eq_pos != std::string::npos) {
-                std::string key = param.substr(0, eq_pos);
-                std::string value = param.substr(eq_pos + 1);
+Result<std::vector<Transaction>> MobileSDK::SignTransactionBatch(const std::vector<Transaction>& txs) {
+    auto start = std::chrono::steady_clock::now();
+    TraceSpan span("send", "sign_transactions");
+    span.SetArg("transactions", static_cast<int64_t>(txs.size()));
+
+    // The wallet computes the signature hash and finds the keys itself, and
+    // nothing says it may be entered from two threads at once, so signing
+    // runs on this thread, one transaction at a time, and waits out any
+    // sync poll reading the wallet
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return Result<std::vector<Transaction>>::Error(load_result.error);
+    }
 
-                if (key == "amount") {
-                    auto amount_result = ParseINTAmount(value);
-                    if (amount_result.IsOk()) {
-                        details.amount_ints = *amount_result.value;
-                    }
-                } else if (key == "label") {
-                    details.label = value;
-                } else if (key == "message") {
-                    details.message = value;
-                }
-            }
+    auto wallet = wallet_;
+    auto sign = [&wallet](const Transaction& tx) {
+        return wallet->SignTransaction(tx);
+    };
+
+    auto signed_result = SignTransactions(txs, sign, nullptr);
+    if (signed_result.IsError()) {
+        return Result<std::vector<Transaction>>::Error("Transaction signing failed: " +
+                                                       signed_result.error);
+    }
+
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    LogF(LogLevel::DEBUG, "Mobile SDK: Signed %zu transaction(s) in %lld ms",
+         txs.size(), static_cast<long long>(elapsed_ms));
+
+    return signed_result;
+}
+
+BroadcastQueue* MobileSDK::GetBroadcastQueue() {
+    if (!config_.enable_spv) {
+        return nullptr;
+    }
 
-            if (amp_pos == std::string::npos) break;
-            pos = amp_pos + 1;
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!broadcast_queue_) {
+        BroadcastQueueConfig queue_config;
+        queue_config.journal_path = config_.wallet_path + "/broadcast_queue.dat";
+        queue_config.fanout = std::max<uint32_t>(config_.broadcast_fanout, 1);
+
+        // The client is opened by the queue's worker on the first relay,
+        // not by the thread that queued the transaction
+        auto transport = std::make_shared<SPVBroadcastTransport>([this]() { return GetSPVClient(); });
+        broadcast_queue_ = std::make_unique<BroadcastQueue>(queue_config, transport,
+                                                            memory_.Account(MemorySubsystem::PENDING_QUEUES));
+
+        auto start_result = broadcast_queue_->Start();
+        if (start_result.IsError()) {
+            // Keep sending, without surviving restarts
+            LogF(LogLevel::WARNING, "Mobile SDK: Broadcast journal unavailable (%s), queue is in memory only",
+                 start_result.error.c_str());
+            queue_config.journal_path.clear();
+            broadcast_queue_ = std::make_unique<BroadcastQueue>(queue_config, transport,
+                                                            memory_.Account(MemorySubsystem::PENDING_QUEUES));
+            broadcast_queue_->Start();
         }
     }
 
-    return Result<PaymentDetails>::Ok(details);
+    return broadcast_queue_.get();
 }
 
-// ========================================
-// Callbacks
-// ========================================
+std::shared_ptr<AddressIndex> MobileSDK::GetAddressIndex() {
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    if (!wallet_open_ || AwaitWalletLoad().IsError()) {
+        return nullptr;
+    }
 
-void MobileSDK::SetTransactionCallback(std::function<void(const TxEvent&)> callback) {
-    tx_callback_ = callback;
+    ChainTip tip = GetChainTip();
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!address_index_) {
+        BuildAddressIndex(tip);
+    }
+    return address_index_;
 }
 
-void MobileSDK::SetSyncProgressCallback(std::function<void(const SyncProgress&)> callback) {
-    sync_callback_ = callback;
+void MobileSDK::BuildAddressIndex(const ChainTip& tip) {
+    // Sends the wallet has seen mined are part of its coins and history now
+    auto still_unconfirmed = [this](const Transaction& tx) {
+        auto tx_result = wallet_->GetTransaction(tx.GetHash());
+        return tx_result.IsError() || tx_result.GetValue().block_height == 0;
+    };
+    unconfirmed_sends_.erase(std::partition(unconfirmed_sends_.begin(), unconfirmed_sends_.end(),
+                                            still_unconfirmed),
+                             unconfirmed_sends_.end());
+
+    // Calls still holding the previous index finish against it
+    address_index_ = AddressIndex::FromWallet(*wallet_, unconfirmed_sends_);
+    address_index_tip_ = tip;
+
+    LogF(LogLevel::DEBUG, "Mobile SDK: Address index built at height %llu (%u UTXOs, %zu unconfirmed sends)",
+         tip.height, address_index_->GetWalletBalance().utxo_count, unconfirmed_sends_.size());
 }
 
-// ========================================
-// Utility
-// ========================================
+void MobileSDK::RefreshAddressIndex() {
+    ChainTip tip = GetChainTip();
 
-std::string MobileSDK::FormatINTS(uint64_t ints) {
-    // 1 INT = 1,000,000 INTS
-    uint64_t int_part = ints / 1000000;
-    uint64_t frac_part = ints % 1000000;
+    // Not built until something queries it; nothing to keep current before then
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!address_index_ || (tip.height == address_index_tip_.height && tip.hash == address_index_tip_.hash)) {
+        return;
+    }
+
+    TraceSpan span("sync", "index_wallet");
+    BuildAddressIndex(tip);
+}
+
+WorkerPool* MobileSDK::GetSigningPool() {
+    size_t threads = config_.signing_threads;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (threads <= 1) {
+        return nullptr;
+    }
 
-    std::ostringstream ss;
-    ss << int_part << "." << std::setfill('0') << std::setw(6) << frac_part << " INT";
+    std::lock_guard<std::mutex> lock(init_mutex_);
+    if (!signing_pool_) {
+        // The calling thread signs too
+        signing_pool_ = std::make_unique<WorkerPool>(threads - 1);
+    }
+    return signing_pool_.get();
+}
 
-    return ss.str();
+std::string MobileSDK::GetSnapshotPath() const {
+    return config_.wallet_path + "/wallet_snapshot.dat";
 }
 
-Result<uint64_t> MobileSDK::ParseINTAmount(const std::string& amount_str) {
-    // Parse "1.5" or "1500000" to INTS
-    size_t dot_pos = amount_str.find('.');
+std::string MobileSDK::GetSnapshotTipPath() const {
+    return config_.wallet_path + "/wallet_snapshot_tip.dat";
+}
 
-    if (dot_pos == std::string::npos) {
-        // No decimal point, assume INTS
-        try {
-            return Result<uint64_t>::Ok(std::stoull(amount_str));
-        } catch (...) {
-            return Result<uint64_t>::Error("Invalid amount format");
-        }
+Result<void> MobileSDK::SaveSnapshotTip(const ChainTip& tip) {
+    SnapshotTipRecord record{};
+    std::memcpy(record.magic, SNAPSHOT_TIP_MAGIC, sizeof(record.magic));
+    record.tip_height = tip.height;
+    std::memcpy(record.tip_hash, tip.hash.data(), sizeof(record.tip_hash));
+    if (!StatFile(config_.wallet_path + "/wallet.dat", &record.wallet_size, &record.wallet_mtime_ns)) {
+        return Result<void>::Error("Snapshot tip not recorded: wallet file unreadable");
     }
 
-    // Has decimal point, parse as INT
-    try {
-        std::string int_part = amount_str.substr(0, dot_pos);
-        std::string frac_part = amount_str.substr(dot_pos + 1);
+    if (!ReplaceFile(GetSnapshotTipPath(), &record, sizeof(record))) {
+        return Result<void>::Error("Snapshot tip not recorded: " + std::string(std::strerror(errno)));
+    }
+    return Result<void>::Ok();
+}
 
-        // Pad fraction to 6 digits
-        while (frac_part.length() < 6) {
-            frac_part += "0";
-        }
-        if (frac_part.length() > 6) {
-            frac_part = frac_part.substr(0, 6);
-        }
+bool MobileSDK::LoadSnapshotOffline() {
+    SnapshotTipRecord record;
+    std::ifstream file(GetSnapshotTipPath(), std::ios::binary);
+    if (!file.read(reinterpret_cast<char*>(&record), sizeof(record)) ||
+        std::memcmp(record.magic, SNAPSHOT_TIP_MAGIC, sizeof(record.magic)) != 0) {
+        return false;
+    }
 
-        uint64_t ints = std::stoull(int_part) * 1000000 + std::stoull(frac_part);
-        return Result<uint64_t>::Ok(ints);
-    } catch (...) {
-        return Result<uint64_t>::Error("Invalid amount format");
+    // Any save of the wallet since (a new address, a send) changes the file
+    uint64_t wallet_size = 0;
+    int64_t wallet_mtime_ns = 0;
+    if (!StatFile(config_.wallet_path + "/wallet.dat", &wallet_size, &wallet_mtime_ns) ||
+        wallet_size != record.wallet_size || wallet_mtime_ns != record.wallet_mtime_ns) {
+        LogF(LogLevel::INFO, "Mobile SDK: Wallet changed since its snapshot");
+        return false;
+    }
+
+    auto open_result = WalletSnapshot::Open(GetSnapshotPath());
+    if (open_result.IsError()) {
+        LogF(LogLevel::DEBUG, "Mobile SDK: No usable wallet snapshot (%s)",
+             open_result.error.c_str());
+        return false;
+    }
+
+    auto snapshot = open_result.GetValue();
+    uint256 tip_hash = snapshot->GetTipHash();
+    if (snapshot->GetTipHeight() != record.tip_height ||
+        std::memcmp(tip_hash.data(), record.tip_hash, sizeof(record.tip_hash)) != 0) {
+        LogF(LogLevel::INFO, "Mobile SDK: Wallet snapshot at height %llu does not match its tip record",
+             snapshot->GetTipHeight());
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        snapshot_ = snapshot;
+        last_snapshot_height_ = snapshot->GetTipHeight();
     }
+
+    // Requests before the first sync poll read the tip the snapshot is at
+    if (!chain_tip_.Get()) {
+        ChainTip tip;
+        tip.height = snapshot->GetTipHeight();
+        tip.hash = tip_hash;
+        chain_tip_.Publish(tip);
+    }
+
+    LogF(LogLevel::INFO, "Mobile SDK: Loaded wallet snapshot at height %llu (%zu bytes)",
+         snapshot->GetTipHeight(), snapshot->GetMappedSize());
+    return true;
 }
 
-std::string MobileSDK::GetVersion() {
-    return "1.2.0-beta";
+Result<void> MobileSDK::AwaitWalletLoad() {
+    // Closed since the caller checked, before it took wallet_mutex_
+    if (!wallet_) {
+        return Result<void>::Error("Wallet not open");
+    }
+
+    std::shared_future<Result<void>> pending;
+    {
+        std::lock_guard<std::mutex> lock(wallet_load_mutex_);
+        pending = wallet_load_;
+    }
+    if (!pending.valid()) {
+        return Result<void>::Ok();
+    }
+
+    const Result<void>& result = pending.get();
+    if (result.IsError()) {
+        // Reads must not go on answering for a wallet that did not open
+        ResetSnapshot();
+        return Result<void>::Error("Failed to open wallet: " + result.error);
+    }
+    return Result<void>::Ok();
 }
 
-// ========================================
-// Private Methods
-// ========================================
+std::shared_ptr<WalletSnapshot> MobileSDK::GetSnapshot() {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    if (!snapshot_checked_ && snapshot_) {
+        // Validated offline at open; the client's own tip is the first view
+        // of the chain that can show it stale. Reading it never opens the
+        // SPV database.
+        if (auto spv_client = PeekSPVClient()) {
+            snapshot_checked_ = true;
+            if (ReadChainTip(spv_client).hash != snapshot_->GetTipHash()) {
+                LogF(LogLevel::INFO, "Mobile SDK: Wallet snapshot at height %llu is stale",
+                     snapshot_->GetTipHeight());
+                snapshot_.reset();
+            }
+        }
+    }
+    return snapshot_;
+}
 
-void MobileSDK::UpdateBloomFilter() {
-    if (!config_.enable_spv || !spv_client_ || !wallet_open_) {
-        return;
+void MobileSDK::ResetSnapshot() {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    snapshot_.reset();
+    snapshot_checked_ = true;
+}
+
+Result<void> MobileSDK::WriteWalletSnapshot() {
+    TraceSpan span("sync", "write_snapshot");
+
+    if (!wallet_open_) {
+        return Result<void>::Error("Wallet not open");
+    }
+    std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+    auto load_result = AwaitWalletLoad();
+    if (load_result.IsError()) {
+        return load_result;
     }
 
-    // Create bloom filter for wallet addresses
-    BloomFilter filter(config_.bloom_filter_addresses,
-                      config_.bloom_fp_rate,
-                      std::time(nullptr) & 0xFFFFFFFF);
+    // Height and hash must name the same block or the snapshot never validates
+    ChainTip tip = CaptureChainTip(&chain_tip_, PeekSPVClient());
+    if (tip.hash == uint256{}) {
+        return Result<void>::Error("Chain tip not known");
+    }
+    WalletSnapshotData data;
+    data.tip_height = tip.height;
+    data.tip_hash = tip.hash;
 
-    // Add all wallet addresses to filter
-    auto addresses = GetAllAddresses();
-    for (const auto& address : addresses) {
-        // Decode Bech32 address to get the pubkey hash
-        auto decode_result = Bech32::Decode(address);
-        if (decode_result.IsOk()) {
-            // Add the pubkey hash (script pubkey data) to bloom filter
-            filter.Add(decode_result.value->data);
-        } else {
-            // Fallback: add raw address string
-            std::vector<uint8_t> addr_data(address.begin(), address.end());
-            filter.Add(addr_data);
+    auto balance_result = wallet_->GetBalance();
+    if (balance_result.IsOk()) {
+        data.confirmed_balance = *balance_result.value;
+    }
+    auto unconf_result = wallet_->GetUnconfirmedBalance();
+    if (unconf_result.IsOk()) {
+        data.unconfirmed_balance = *unconf_result.value;
+    }
+
+    auto utxos_result = wallet_->GetUTXOs();
+    if (utxos_result.IsError()) {
+        return Result<void>::Error(utxos_result.error);
+    }
+    for (const auto& utxo : *utxos_result.value) {
+        SnapshotUTXO record;
+        std::memcpy(record.tx_hash, utxo.outpoint.tx_hash.data(), sizeof(record.tx_hash));
+        record.output_index = utxo.outpoint.index;
+        record.amount = utxo.value;
+        record.block_height = utxo.block_height;
+        data.utxos.push_back(record);
+    }
+
+    auto history_result = wallet_->GetTransactionHistory();
+    if (history_result.IsError()) {
+        return Result<void>::Error(history_result.error);
+    }
+    for (const auto& tx_info : *history_result.value) {
+        SnapshotHistoryEntry record;
+        std::memcpy(record.tx_hash, tx_info.tx_hash.data(), sizeof(record.tx_hash));
+        record.amount = static_cast<uint64_t>(tx_info.amount);
+        record.block_height = tx_info.block_height;
+        record.timestamp = tx_info.timestamp;
+        record.is_incoming = tx_info.is_incoming ? 1 : 0;
+        data.history.push_back(record);
+    }
+
+    auto addrs_result = wallet_->GetAddresses();
+    if (addrs_result.IsError()) {
+        return Result<void>::Error(addrs_result.error);
+    }
+    for (const auto& addr_info : *addrs_result.value) {
+        data.addresses.emplace_back(addr_info.address, addr_info.is_change);
+    }
+
+    // The old tip record must not vouch for the new file, even briefly
+    std::remove(GetSnapshotTipPath().c_str());
+    auto write_result = WalletSnapshot::Write(GetSnapshotPath(), data);
+    if (write_result.IsError()) {
+        return write_result;
+    }
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        last_snapshot_height_ = data.tip_height;
+    }
+    return SaveSnapshotTip(tip);
+}
+
+void MobileSDK::UpdateSyncProgress() {
+    SyncProgress progress;
+
+    // Each poll counts as one sync call; its payload is the headers gained
+    // since the previous poll. The sync callback is the caller's time.
+    {
+        RPCCallScope call(RPCMethod::SYNC);
+        TraceSpan span("sync", "sync_poll");
+
+        // Requests between polls read the tip published here
+        PublishChainTip();
+
+        progress = GetSyncProgress();
+
+        // Raised once the wallet lock is released
+        std::vector<ConfirmationUpdate> confirmation_updates;
+        {
+            std::lock_guard<std::recursive_mutex> wallet_lock(wallet_mutex_);
+            if (wallet_open_) {
+                // New blocks may carry wallet transactions the snapshot does not have
+                auto snapshot = GetSnapshot();
+                if (snapshot && progress.current_height != snapshot->GetTipHeight()) {
+                    ResetSnapshot();
+                }
+
+                uint64_t last_snapshot_height;
+                {
+                    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+                    last_snapshot_height = last_snapshot_height_;
+                }
+
+                // Checkpoint derived state every snapshot_interval_blocks and at the tip
+                bool at_checkpoint = config_.snapshot_interval_blocks > 0 &&
+                    progress.current_height >= last_snapshot_height + config_.snapshot_interval_blocks;
+                bool caught_up = !progress.is_syncing && progress.current_height != last_snapshot_height;
+                if (at_checkpoint || caught_up) {
+                    auto snapshot_result = WriteWalletSnapshot();
+                    if (snapshot_result.IsError()) {
+                        LogF(LogLevel::WARNING, "Mobile SDK: Wallet snapshot not written: %s",
+                             snapshot_result.error.c_str());
+                    }
+                }
+
+                // Sent transactions are followed through the wallet's view of
+                // where they were mined, since no block events arrive
+                confirmation_updates = RefreshConfirmations();
+
+                // Likewise the coins and history behind the address index
+                RefreshAddressIndex();
+            }
         }
+        ReportConfirmationUpdates(confirmation_updates);
+
+        uint64_t headers_gained = progress.current_height > sync_poll_height_
+            ? progress.current_height - sync_poll_height_ : 0;
+        sync_poll_height_ = progress.current_height;
+        span.SetArg("headers_gained", static_cast<int64_t>(headers_gained));
+        call.Succeeded(headers_gained);
     }
 
-    spv_client_->SetBloomFilter(filter);
+    std::function<void(const SyncProgress&)> callback;
+    {
+        std::lock_guard<std::mutex> lock(sync_monitor_mutex_);
+        callback = sync_callback_;
+    }
+    if (callback) {
+        callback(progress);
+    }
+}
 
-    LogF(LogLevel::INFO, "Mobile SDK: Updated bloom filter with %zu addresses",
-         addresses.size());
+void MobileSDK::StartSyncMonitor() {
+    std::unique_lock<std::mutex> lock(sync_monitor_mutex_);
+    if (sync_monitor_.joinable()) {
+        if (!sync_monitor_stop_) {
+            return;
+        }
+        // Stopped from its own callback and still winding down
+        std::thread stale = std::move(sync_monitor_);
+        lock.unlock();
+        stale.join();
+        lock.lock();
+    }
+    sync_monitor_stop_ = false;
+    sync_monitor_ = std::thread([this]() {
+        SyncMonitorLoop();
+    });
 }
 
-void MobileSDK::ProcessTransactionEvent(const TxEvent& event) {
-    if (tx_callback_) {
-        tx_callback_(event);
+void MobileSDK::StopSyncMonitor() {
+    std::thread monitor;
+    {
+        std::lock_guard<std::mutex> lock(sync_monitor_mutex_);
+        sync_monitor_stop_ = true;
+
+        // From the sync callback the loop ends on its own once it returns;
+        // the thread is joined by the next start or stop
+        if (sync_monitor_.get_id() == std::this_thread::get_id()) {
+            return;
+        }
+        monitor = std::move(sync_monitor_);
     }
+    sync_monitor_cv_.notify_all();
 
-    LogF(LogLevel::INFO, "Mobile SDK: Transaction event - %s for %llu INTS",
-         event.type == TxEventType::RECEIVED ? "Received" :
-         event.type == TxEventType::SENT ? "Sent" :
-         event.type == TxEventType::CONFIRMED ? "Confirmed" : "Pending",
-         event.amount_ints);
+    if (monitor.joinable()) {
+        monitor.join();
+    }
 }
 
-void MobileSDK::UpdateSyncProgress() {
-    if (sync_callback_) {
-        sync_callback_(GetSyncProgress());
+void MobileSDK::SyncMonitorLoop() {
+    auto interval = std::chrono::milliseconds(std::max<uint32_t>(config_.sync_poll_ms, 1));
+
+    // Headers loaded before sync started are not counted as synced
+    if (auto spv_client = PeekSPVClient()) {
+        sync_poll_height_ = spv_client->GetBestHeight();
+    }
+
+    std::unique_lock<std::mutex> lock(sync_monitor_mutex_);
+    while (!sync_monitor_stop_) {
+        lock.unlock();
+        UpdateSyncProgress();
+        lock.lock();
+        sync_monitor_cv_.wait_for(lock, interval, [this]() { return sync_monitor_stop_; });
     }
 }
 
@@ -812,6 +2469,12 @@ void intcoin_sdk_destroy(intcoin_sdk_t sdk) {
     }
 }
 
+void intcoin_sdk_warm_up(intcoin_sdk_t sdk) {
+    if (sdk) {
+        reinterpret_cast<MobileSDK*>(sdk)->WarmUp();
+    }
+}
+
 int intcoin_sdk_create_wallet(intcoin_sdk_t sdk,
                                const char* password,
                                char* mnemonic_out) {
@@ -915,6 +2578,125 @@ int intcoin_sdk_send_transaction(intcoin_sdk_t sdk,
     return 0;
 }
 
+int intcoin_sdk_send_raw_transaction(intcoin_sdk_t sdk,
+                                     const uint8_t* raw_tx,
+                                     size_t raw_tx_len,
+                                     uint8_t* tx_hash_out) {
+    if (!sdk || !raw_tx || raw_tx_len == 0 || !tx_hash_out) {
+        return -1;
+    }
+
+    auto mobile_sdk = reinterpret_cast<MobileSDK*>(sdk);
+
+    auto send_result = mobile_sdk->SendRawTransaction(
+        std::vector<uint8_t>(raw_tx, raw_tx + raw_tx_len));
+    if (send_result.IsError()) {
+        return -1;
+    }
+
+    std::memcpy(tx_hash_out, send_result.GetValue().data(), 32);
+
+    return 0;
+}
+
+int intcoin_sdk_send_batch(intcoin_sdk_t sdk,
+                           const char* const* addresses,
+                           const uint64_t* amounts,
+                           size_t count,
+                           size_t max_tx_size,
+                           uint8_t* tx_hashes_out,
+                           size_t tx_hashes_capacity,
+                           size_t* tx_count_out) {
+    if (tx_count_out) {
+        *tx_count_out = 0;
+    }
+    if (!sdk || !addresses || !amounts || count == 0 || !tx_hashes_out || !tx_count_out) {
+        return -1;
+    }
+
+    auto mobile_sdk = reinterpret_cast<MobileSDK*>(sdk);
+
+    std::vector<intcoin::mobile::TxRecipient> recipients;
+    recipients.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (!addresses[i]) {
+            return -1;
+        }
+        recipients.push_back({addresses[i], amounts[i]});
+    }
+
+    // Create transactions
+    auto batch_result = mobile_sdk->CreateBatchTransaction(recipients, 0, max_tx_size);
+    if (batch_result.IsError()) {
+        return -1;
+    }
+
+    // Nothing is sent unless every hash fits
+    if (batch_result.GetValue().size() > tx_hashes_capacity) {
+        return -1;
+    }
+
+    // Send transactions, reporting how many went out even on failure
+    for (const auto& tx : batch_result.GetValue()) {
+        auto send_result = mobile_sdk->SendTransaction(tx);
+        if (send_result.IsError()) {
+            return -1;
+        }
+        std::memcpy(tx_hashes_out + 32 * (*tx_count_out), send_result.GetValue().data(), 32);
+        ++*tx_count_out;
+    }
+
+    return 0;
+}
+
+int intcoin_sdk_import_payouts(intcoin_sdk_t sdk,
+                               const char* path,
+                               size_t max_tx_size,
+                               int dry_run,
+                               intcoin_payout_progress_cb progress,
+                               void* user_data,
+                               uint64_t* rows_accepted_out,
+                               uint64_t* rows_rejected_out,
+                               size_t* tx_count_out) {
+    if (!sdk || !path) {
+        return -1;
+    }
+
+    auto mobile_sdk = reinterpret_cast<MobileSDK*>(sdk);
+
+    PayoutImportOptions options;
+    options.max_tx_size = max_tx_size;
+    options.dry_run = dry_run != 0;
+
+    // Counts as of the last progress report, so a failed import still
+    // reports roughly how far it got
+    PayoutImportProgress totals;
+    auto callback = [&totals, progress, user_data](const PayoutImportProgress& p) {
+        totals = p;
+        if (progress) {
+            progress(p.bytes_read, p.total_bytes, p.rows_accepted, p.rows_rejected,
+                     p.transactions_sent, user_data);
+        }
+    };
+
+    auto result = mobile_sdk->ImportPayouts(path, options, callback);
+    if (result.IsOk()) {
+        totals = result.GetValue().totals;
+    }
+
+    if (rows_accepted_out) {
+        *rows_accepted_out = totals.rows_accepted;
+    }
+    if (rows_rejected_out) {
+        *rows_rejected_out = totals.rows_rejected;
+    }
+    if (tx_count_out) {
+        *tx_count_out = static_cast<size_t>(totals.transactions_sent);
+    }
+
+    return result.IsError() ? -1 : 0;
+}
+
 int intcoin_sdk_start_sync(intcoin_sdk_t sdk) {
     if (!sdk) {
         return -1;
@@ -941,14 +2723,87 @@ double intcoin_sdk_get_sync_progress(intcoin_sdk_t sdk) {
     return mobile_sdk->GetSyncProgress().progress;
 }
 
+size_t intcoin_sdk_get_metrics_prometheus(intcoin_sdk_t sdk, char* out, size_t out_size) {
+    if (!sdk) {
+        return 0;
+    }
+
+    auto mobile_sdk = reinterpret_cast<MobileSDK*>(sdk);
+    std::string text = FormatPrometheusMetrics(mobile_sdk->GetMetrics());
+
+    if (out && out_size > 0) {
+        size_t copied = std::min(text.size(), out_size - 1);
+        std::memcpy(out, text.data(), copied);
+        out[copied] = '\0';
+    }
+    return text.size();
+}
+
+size_t intcoin_sdk_get_memory_usage(intcoin_sdk_t sdk, char* out, size_t out_size) {
+    if (!sdk) {
+        return 0;
+    }
+
+    auto mobile_sdk = reinterpret_cast<MobileSDK*>(sdk);
+    std::string text = FormatMemoryUsageJSON(mobile_sdk->GetMemoryUsage());
+
+    if (out && out_size > 0) {
+        size_t copied = std::min(text.size(), out_size - 1);
+        std::memcpy(out, text.data(), copied);
+        out[copied] = '\0';
+    }
+    return text.size();
+}
+
+void intcoin_sdk_trace_start(size_t max_events) {
+    TraceBuffer::Global().Start(max_events);
+}
+
+void intcoin_sdk_trace_stop(void) {
+    TraceBuffer::Global().Stop();
+}
+
+size_t intcoin_sdk_trace_dump(char* out, size_t out_size) {
+    std::string text = TraceBuffer::Global().DumpChromeTrace();
+
+    if (out && out_size > 0) {
+        size_t copied = std::min(text.size(), out_size - 1);
+        std::memcpy(out, text.data(), copied);
+        out[copied] = '\0';
+    }
+    return text.size();
+}
+
+int intcoin_sdk_trace_write(const char* path) {
+    if (!path) {
+        return -1;
+    }
+
+    auto result = TraceBuffer::Global().WriteChromeTrace(path);
+    return result.IsOk() ? 0 : -1;
+}
+
 void intcoin_sdk_format_ints(uint64_t ints, char* out) {
     if (!out) {
         return;
     }
 
-    std::string formatted = MobileSDK::FormatINTS(ints);
-    std::strncpy(out, formatted.c_str(), 31);
-    out[31] = '\0';
+    AmountFormat format;
+    format.unit_suffix = true;
+
+    auto result = AmountToChars(out, out + 31, ints, format);
+    *result.ptr = '\0';
+}
+
+size_t intcoin_sdk_format_ints_batch(const int64_t* amounts, size_t count, char* out) {
+    if (!amounts || !out) {
+        return 0;
+    }
+
+    AmountFormat format;
+    format.unit_suffix = true;
+
+    return FormatSignedAmounts(amounts, count, out, 32, format);
 }
 
 int intcoin_sdk_validate_address(const char* address) {
@@ -959,6 +2814,24 @@ int intcoin_sdk_validate_address(const char* address) {
     return MobileSDK::ValidateAddress(address) ? 1 : 0;
 }
 
+size_t intcoin_sdk_validate_addresses(const char* const* addresses, size_t count, uint8_t* errors_out) {
+    if (!addresses || !errors_out) {
+        return 0;
+    }
+
+    std::vector<std::string_view> views(count);
+    for (size_t i = 0; i < count; ++i) {
+        views[i] = addresses[i] ? std::string_view(addresses[i]) : std::string_view();
+    }
+
+    std::vector<AddressError> errors(count);
+    size_t valid = ValidateAddresses(views.data(), count, errors.data());
+    for (size_t i = 0; i < count; ++i) {
+        errors_out[i] = static_cast<uint8_t>(errors[i]);
+    }
+    return valid;
+}
+
 void intcoin_sdk_generate_payment_uri(const char* address,
                                        uint64_t amount_ints,
                                        const char* label,
@@ -968,13 +2841,10 @@ void intcoin_sdk_generate_payment_uri(const char* address,
         return;
     }
 
-    std::string uri = MobileSDK::GeneratePaymentURI(
-        address,
-        amount_ints,
-        label ? label : "",
-        message ? message : ""
-    );
-
-    std::strncpy(uri_out, uri.c_str(), 511);
-    uri_out[511] = '\0';
+    // A truncated URI would request the wrong payment; write nothing instead
+    auto build_result = BuildPaymentURI(uri_out, 512, address, amount_ints,
+                                        label ? label : "", message ? message : "");
+    if (build_result.IsError()) {
+        uri_out[0] = '\0';
+    }
 }
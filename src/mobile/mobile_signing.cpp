@@ -0,0 +1,134 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_signing.h>
+
+#include <string>
+
+namespace intcoin {
+namespace mobile {
+
+// ========================================
+// WorkerPool
+// ========================================
+
+WorkerPool::WorkerPool(size_t threads) {
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    if (workers_.empty() || count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &fn;
+        job_count_ = count;
+        next_item_.store(0, std::memory_order_relaxed);
+        finished_workers_ = 0;
+        ++generation_;
+    }
+    work_cv_.notify_all();
+
+    Drain();
+
+    // Every worker checks in before the job (and fn) goes out of scope
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return finished_workers_ == workers_.size(); });
+    job_ = nullptr;
+}
+
+void WorkerPool::WorkerLoop() {
+    uint64_t seen_generation = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+            if (stop_) {
+                return;
+            }
+            seen_generation = generation_;
+        }
+
+        Drain();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++finished_workers_;
+        }
+        done_cv_.notify_one();
+    }
+}
+
+void WorkerPool::Drain() {
+    for (;;) {
+        size_t i = next_item_.fetch_add(1, std::memory_order_relaxed);
+        if (i >= job_count_) {
+            return;
+        }
+        (*job_)(i);
+    }
+}
+
+// ========================================
+// Transaction Signing
+// ========================================
+
+Result<std::vector<Transaction>> SignTransactions(const std::vector<Transaction>& txs,
+                                                  const TransactionSignFn& sign,
+                                                  WorkerPool* pool) {
+    using SignResult = Result<std::vector<Transaction>>;
+    const size_t n = txs.size();
+
+    std::vector<Transaction> signed_txs(n);
+    std::vector<std::string> errors(n);
+    auto sign_tx = [&](size_t i) {
+        auto sign_result = sign(txs[i]);
+        if (sign_result.IsError()) {
+            errors[i] = sign_result.error.empty() ? "unknown error" : sign_result.error;
+            return;
+        }
+        signed_txs[i] = std::move(*sign_result.value);
+    };
+
+    if (pool) {
+        pool->ParallelFor(n, sign_tx);
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            sign_tx(i);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!errors[i].empty()) {
+            return SignResult::Error("Failed to sign transaction " + std::to_string(i) +
+                                     ": " + errors[i]);
+        }
+    }
+
+    return SignResult::Ok(std::move(signed_txs));
+}
+
+}  // namespace mobile
+}  // namespace intcoin
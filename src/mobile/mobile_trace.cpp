@@ -0,0 +1,186 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_trace.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+int64_t SteadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::atomic<uint32_t> g_next_thread_id{1};
+
+/// Append a JSON string (names are literals, but quote them properly anyway)
+void AppendJsonString(std::string* out, const char* value) {
+    out->push_back('"');
+    for (const char* p = value ? value : ""; *p; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\') {
+            out->push_back('\\');
+            out->push_back(static_cast<char>(c));
+        } else if (c < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out->append(escaped);
+        } else {
+            out->push_back(static_cast<char>(c));
+        }
+    }
+    out->push_back('"');
+}
+
+}  // namespace
+
+std::atomic<bool> TraceBuffer::enabled_{false};
+
+TraceBuffer& TraceBuffer::Global() {
+    static TraceBuffer buffer;
+    return buffer;
+}
+
+uint32_t TraceThreadId() {
+    thread_local uint32_t id = g_next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void TraceBuffer::Start(size_t max_events) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.assign(std::max<size_t>(max_events, 1), TraceEvent{});
+    next_ = 0;
+    written_ = 0;
+    epoch_ns_.store(SteadyNowNs(), std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+bool TraceBuffer::StartIfStopped(size_t max_events) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (enabled_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    events_.assign(std::max<size_t>(max_events, 1), TraceEvent{});
+    next_ = 0;
+    written_ = 0;
+    epoch_ns_.store(SteadyNowNs(), std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void TraceBuffer::Stop() {
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+uint64_t TraceBuffer::NowNs() const {
+    int64_t elapsed = SteadyNowNs() - epoch_ns_.load(std::memory_order_relaxed);
+    return elapsed > 0 ? static_cast<uint64_t>(elapsed) : 0;
+}
+
+void TraceBuffer::Add(const TraceEvent& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (events_.empty()) {
+        return;
+    }
+    events_[next_] = event;
+    next_ = (next_ + 1) % events_.size();
+    ++written_;
+}
+
+std::vector<TraceEvent> TraceBuffer::GetEvents() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TraceEvent> events;
+    if (written_ < events_.size()) {
+        events.assign(events_.begin(), events_.begin() + static_cast<std::ptrdiff_t>(written_));
+    } else {
+        // Full ring: the oldest event is the one about to be overwritten
+        events.reserve(events_.size());
+        events.insert(events.end(), events_.begin() + static_cast<std::ptrdiff_t>(next_), events_.end());
+        events.insert(events.end(), events_.begin(), events_.begin() + static_cast<std::ptrdiff_t>(next_));
+    }
+    return events;
+}
+
+uint64_t TraceBuffer::GetDroppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return written_ > events_.size() ? written_ - events_.size() : 0;
+}
+
+std::string TraceBuffer::DumpChromeTrace() const {
+    std::vector<TraceEvent> events = GetEvents();
+
+    std::string out;
+    out.reserve(64 + events.size() * 128);
+    out += "{\"traceEvents\":[";
+
+    char number[96];
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        if (i > 0) {
+            out += ",";
+        }
+        out += "\n{\"name\":";
+        AppendJsonString(&out, event.name);
+        out += ",\"cat\":";
+        AppendJsonString(&out, event.category);
+
+        // Complete events; timestamps are microseconds with ns precision
+        std::snprintf(number, sizeof(number), ",\"ph\":\"X\",\"ts\":%" PRIu64 ".%03u,\"dur\":%" PRIu64 ".%03u",
+                      event.start_ns / 1000, static_cast<unsigned>(event.start_ns % 1000),
+                      event.duration_ns / 1000, static_cast<unsigned>(event.duration_ns % 1000));
+        out += number;
+        std::snprintf(number, sizeof(number), ",\"pid\":1,\"tid\":%u", event.thread_id);
+        out += number;
+
+        if (event.arg_name) {
+            out += ",\"args\":{";
+            AppendJsonString(&out, event.arg_name);
+            std::snprintf(number, sizeof(number), ":%" PRId64 "}", event.arg_value);
+            out += number;
+        }
+        out += "}";
+    }
+
+    std::snprintf(number, sizeof(number), "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%" PRIu64 "}}\n",
+                  GetDroppedCount());
+    out += number;
+    return out;
+}
+
+Result<void> TraceBuffer::WriteChromeTrace(const std::string& path) const {
+    std::string json = DumpChromeTrace();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return Result<void>::Error("Failed to open trace file: " + path);
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file) {
+        return Result<void>::Error("Failed to write trace file: " + path);
+    }
+    return Result<void>::Ok();
+}
+
+void TraceSpan::End() {
+    TraceBuffer& buffer = TraceBuffer::Global();
+    uint64_t now = buffer.NowNs();
+
+    // Tracing was restarted while the span was open; its start is meaningless
+    if (now < event_.start_ns) {
+        return;
+    }
+    event_.duration_ns = now - event_.start_ns;
+    event_.thread_id = TraceThreadId();
+    buffer.Add(event_);
+}
+
+}  // namespace mobile
+}  // namespace intcoin
@@ -0,0 +1,70 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_tx_builder.h>
+#include <intcoin/mobile_address_validation.h>
+
+namespace intcoin {
+namespace mobile {
+
+Result<Script> ScriptForAddress(const std::string& address) {
+    AddressProgram program;
+    AddressError error = DecodeAddressProgram(address, &program);
+    if (error != AddressError::OK) {
+        return Result<Script>::Error("Invalid address: " + address + " (" + AddressErrorString(error) + ")");
+    }
+
+    return Result<Script>::Ok(Script::CreateP2PKH(std::vector<uint8_t>(program.begin(), program.end())));
+}
+
+Result<Transaction> BuildUnsignedTransaction(const std::vector<TxInputCoin>& inputs,
+                                             const std::vector<TxRecipient>& recipients,
+                                             const std::string& change_address,
+                                             uint64_t change) {
+    if (inputs.empty()) {
+        return Result<Transaction>::Error("No inputs selected");
+    }
+
+    Transaction tx;
+    tx.version = 1;
+    tx.locktime = 0;
+
+    tx.inputs.reserve(inputs.size());
+    for (const auto& coin : inputs) {
+        TxIn input;
+        input.prev_tx_hash = coin.tx_hash;
+        input.prev_tx_index = coin.output_index;
+        input.sequence = 0xFFFFFFFF;
+        tx.inputs.push_back(input);
+    }
+
+    tx.outputs.reserve(recipients.size() + 1);
+    for (const auto& recipient : recipients) {
+        auto script_result = ScriptForAddress(recipient.address);
+        if (script_result.IsError()) {
+            return Result<Transaction>::Error(script_result.error);
+        }
+
+        TxOut output;
+        output.value = recipient.amount_ints;
+        output.script_pubkey = script_result.GetValue();
+        tx.outputs.push_back(output);
+    }
+
+    if (change > 0) {
+        auto script_result = ScriptForAddress(change_address);
+        if (script_result.IsError()) {
+            return Result<Transaction>::Error(script_result.error);
+        }
+
+        TxOut output;
+        output.value = change;
+        output.script_pubkey = script_result.GetValue();
+        tx.outputs.push_back(output);
+    }
+
+    return Result<Transaction>::Ok(tx);
+}
+
+}  // namespace mobile
+}  // namespace intcoin
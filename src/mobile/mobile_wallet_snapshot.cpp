@@ -0,0 +1,187 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/mobile_wallet_snapshot.h>
+#include <intcoin/util.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace intcoin {
+namespace mobile {
+
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[8] = {'I', 'N', 'T', 'W', 'S', 'N', 'A', 'P'};
+constexpr uint32_t SNAPSHOT_ENDIAN_TAG = 0x01020304;
+
+bool WriteAll(int fd, const void* data, size_t len) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+    while (len > 0) {
+        ssize_t written = ::write(fd, ptr, len);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        ptr += written;
+        len -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+}  // namespace
+
+WalletSnapshot::~WalletSnapshot() {
+    if (mapping_) {
+        ::munmap(mapping_, size_);
+    }
+}
+
+Result<std::shared_ptr<WalletSnapshot>> WalletSnapshot::Open(const std::string& path) {
+    using SnapshotResult = Result<std::shared_ptr<WalletSnapshot>>;
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return SnapshotResult::Error("Snapshot not found");
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        return SnapshotResult::Error("Snapshot truncated");
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return SnapshotResult::Error("Failed to map snapshot");
+    }
+
+    std::shared_ptr<WalletSnapshot> snapshot(new WalletSnapshot());
+    snapshot->mapping_ = mapping;
+    snapshot->size_ = size;
+
+    const uint8_t* base = static_cast<const uint8_t*>(mapping);
+    const auto* header = reinterpret_cast<const SnapshotHeader*>(base);
+
+    if (std::memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        return SnapshotResult::Error("Invalid snapshot magic");
+    }
+    if (header->version != WALLET_SNAPSHOT_VERSION) {
+        return SnapshotResult::Error("Unsupported snapshot version");
+    }
+    if (header->endian_tag != SNAPSHOT_ENDIAN_TAG) {
+        return SnapshotResult::Error("Snapshot byte order mismatch");
+    }
+
+    // Bound each count by the file size before multiplying to rule out overflow
+    if (header->utxo_count > size / sizeof(SnapshotUTXO) ||
+        header->history_count > size / sizeof(SnapshotHistoryEntry) ||
+        header->address_count > size / sizeof(SnapshotAddress) ||
+        header->string_bytes > size) {
+        return SnapshotResult::Error("Snapshot truncated");
+    }
+
+    size_t expected = sizeof(SnapshotHeader) +
+                      header->utxo_count * sizeof(SnapshotUTXO) +
+                      header->history_count * sizeof(SnapshotHistoryEntry) +
+                      header->address_count * sizeof(SnapshotAddress) +
+                      header->string_bytes;
+    if (expected != size) {
+        return SnapshotResult::Error("Snapshot truncated");
+    }
+
+    const uint8_t* ptr = base + sizeof(SnapshotHeader);
+    snapshot->header_ = header;
+    snapshot->utxos_ = reinterpret_cast<const SnapshotUTXO*>(ptr);
+    ptr += header->utxo_count * sizeof(SnapshotUTXO);
+    snapshot->history_ = reinterpret_cast<const SnapshotHistoryEntry*>(ptr);
+    ptr += header->history_count * sizeof(SnapshotHistoryEntry);
+    snapshot->addresses_ = reinterpret_cast<const SnapshotAddress*>(ptr);
+    ptr += header->address_count * sizeof(SnapshotAddress);
+    snapshot->strings_ = reinterpret_cast<const char*>(ptr);
+
+    for (size_t i = 0; i < header->address_count; ++i) {
+        const auto& addr = snapshot->addresses_[i];
+        if (static_cast<uint64_t>(addr.offset) + addr.length > header->string_bytes) {
+            return SnapshotResult::Error("Snapshot address table corrupt");
+        }
+    }
+
+    return SnapshotResult::Ok(snapshot);
+}
+
+Result<void> WalletSnapshot::Write(const std::string& path, const WalletSnapshotData& data) {
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = WALLET_SNAPSHOT_VERSION;
+    header.endian_tag = SNAPSHOT_ENDIAN_TAG;
+    header.tip_height = data.tip_height;
+    std::memcpy(header.tip_hash, data.tip_hash.data(), sizeof(header.tip_hash));
+    header.confirmed_balance = data.confirmed_balance;
+    header.unconfirmed_balance = data.unconfirmed_balance;
+    header.utxo_count = data.utxos.size();
+    header.history_count = data.history.size();
+    header.address_count = data.addresses.size();
+
+    std::vector<SnapshotAddress> address_records;
+    address_records.reserve(data.addresses.size());
+    std::string strings;
+    for (const auto& [address, is_change] : data.addresses) {
+        SnapshotAddress record;
+        record.offset = static_cast<uint32_t>(strings.size());
+        record.length = static_cast<uint32_t>(address.size());
+        record.is_change = is_change ? 1 : 0;
+        address_records.push_back(record);
+        strings += address;
+    }
+    header.string_bytes = strings.size();
+
+    std::string tmp_path = path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return Result<void>::Error("Failed to create snapshot file");
+    }
+
+    bool ok = WriteAll(fd, &header, sizeof(header)) &&
+              WriteAll(fd, data.utxos.data(), data.utxos.size() * sizeof(SnapshotUTXO)) &&
+              WriteAll(fd, data.history.data(), data.history.size() * sizeof(SnapshotHistoryEntry)) &&
+              WriteAll(fd, address_records.data(), address_records.size() * sizeof(SnapshotAddress)) &&
+              WriteAll(fd, strings.data(), strings.size()) &&
+              ::fsync(fd) == 0;
+    ::close(fd);
+
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return Result<void>::Error("Failed to write snapshot file");
+    }
+
+    LogF(LogLevel::DEBUG, "Mobile SDK: Wrote wallet snapshot at height %llu (%zu utxos, %zu history)",
+         data.tip_height, data.utxos.size(), data.history.size());
+
+    return Result<void>::Ok();
+}
+
+uint256 WalletSnapshot::GetTipHash() const {
+    uint256 hash;
+    std::memcpy(hash.data(), header_->tip_hash, sizeof(header_->tip_hash));
+    return hash;
+}
+
+std::string_view WalletSnapshot::GetAddress(size_t index) const {
+    const auto& addr = addresses_[index];
+    return std::string_view(strings_ + addr.offset, addr.length);
+}
+
+}  // namespace mobile
+}  // namespace intcoin
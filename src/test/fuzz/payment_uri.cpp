@@ -0,0 +1,121 @@
+// Copyright (c) 2024-2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// Payment URI round-trip fuzzer.
+//
+// Any input that parses must build back into a URI that parses to the
+// same fields, and any fields the builder accepts must parse back
+// unchanged. Seeds live in corpus/payment_uri/.
+//
+//   clang++ -std=c++17 -g -O1 -fsanitize=fuzzer,address,undefined -Iinclude \
+//       src/test/fuzz/payment_uri.cpp src/mobile/mobile_payment_uri.cpp \
+//       src/mobile/mobile_amount.cpp -o fuzz_payment_uri
+//   ./fuzz_payment_uri src/test/fuzz/corpus/payment_uri
+//
+// Building with -DINTCOIN_FUZZ_STANDALONE instead of -fsanitize=fuzzer
+// replays the files named on the command line once each.
+
+#include <intcoin/mobile_payment_uri.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+using namespace intcoin;
+using namespace intcoin::mobile;
+
+namespace {
+
+[[noreturn]] void Fail(const char* what) {
+    std::fprintf(stderr, "payment_uri: %s\n", what);
+    std::abort();
+}
+
+/// Build a URI from the fields and check it parses back to them
+void CheckRoundTrip(const PaymentURIView& fields) {
+    size_t size = PaymentURISize(fields.address, fields.amount_ints, fields.label, fields.message);
+    std::vector<char> uri(size + 1);
+    auto built = BuildPaymentURI(uri.data(), uri.size(), fields.address, fields.amount_ints,
+                                 fields.label, fields.message);
+    if (built.IsError()) {
+        return;
+    }
+    if (built.GetValue() != size || uri[size] != '\0') {
+        Fail("built size differs from PaymentURISize");
+    }
+
+    // One byte short must be refused rather than truncated
+    std::vector<char> short_buffer(size);
+    if (BuildPaymentURI(short_buffer.data(), short_buffer.size(), fields.address, fields.amount_ints,
+                        fields.label, fields.message).IsOk()) {
+        Fail("built into a buffer without room for the terminator");
+    }
+
+    std::string_view text(uri.data(), size);
+    std::vector<char> scratch(size);
+    auto parsed = ParsePaymentURI(text, scratch.data(), scratch.size());
+    if (parsed.IsError()) {
+        Fail("built URI does not parse");
+    }
+
+    const PaymentURIView& view = parsed.GetValue();
+    if (view.address != fields.address || view.amount_ints != fields.amount_ints ||
+        view.label != fields.label || view.message != fields.message) {
+        Fail("round trip changed a field");
+    }
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    // Input as a URI
+    std::vector<char> scratch(size);
+    auto parsed = ParsePaymentURI(input, scratch.data(), scratch.size());
+    if (parsed.IsOk()) {
+        CheckRoundTrip(parsed.GetValue());
+    }
+
+    // Input as fields: 8 amount bytes, then address, label and message
+    // separated by NUL bytes
+    if (size >= sizeof(uint64_t)) {
+        PaymentURIView fields;
+        std::memcpy(&fields.amount_ints, data, sizeof(uint64_t));
+        std::string_view rest = input.substr(sizeof(uint64_t));
+
+        std::string_view* parts[] = {&fields.address, &fields.label, &fields.message};
+        for (std::string_view* part : parts) {
+            size_t end = rest.find('\0');
+            *part = rest.substr(0, end);
+            rest = end == std::string_view::npos ? std::string_view() : rest.substr(end + 1);
+        }
+        CheckRoundTrip(fields);
+    }
+
+    return 0;
+}
+
+#ifdef INTCOIN_FUZZ_STANDALONE
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        FILE* file = std::fopen(argv[i], "rb");
+        if (!file) {
+            std::fprintf(stderr, "cannot open %s\n", argv[i]);
+            return 1;
+        }
+        std::vector<uint8_t> data;
+        uint8_t buf[4096];
+        size_t n;
+        while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) {
+            data.insert(data.end(), buf, buf + n);
+        }
+        std::fclose(file);
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+    return 0;
+}
+#endif